@@ -3,6 +3,9 @@
 #include <ComponentRegistration.h>
 #include <ProjectPacker.h>
 #include <Replication.h>
+#include <StateHistory.h>
+#include <MovePredictor.h>
+#include <TransformQuantizer.h>
 #include <assets/AssetRegistry.h>
 #include <scenes/SceneManager.h>
 #include <scenes/SceneAsset.h>
@@ -10,8 +13,10 @@
 #include <objects/Object.h>
 #include <objects/components/PlayerController.h>
 #include <objects/components/Camera.h>
+#include <objects/components/Transform.h>
 #include <GpuAssetCache.h>
 #include <RenderSystem.h>
+#include <TransformInterpolator.h>
 #include <InputCapture.h>
 #include <NetClient.h>
 #include <ServerProcess.h>
@@ -19,7 +24,6 @@
 #include <VulkanEngine/VulkanEngine.h>
 #include <chrono>
 #include <iostream>
-#include <random>
 #include <thread>
 
 ClientApp::ClientApp(ConnectOptions options)
@@ -27,7 +31,9 @@ ClientApp::ClientApp(ConnectOptions options)
     m_host(std::make_shared<ManagedHost>()),
     m_componentRegistry(std::make_shared<ComponentRegistry>()),
     m_assetRegistry(std::make_shared<AssetRegistry>()),
-    m_sceneManager(std::make_shared<SceneManager>())
+    m_sceneManager(std::make_shared<SceneManager>()),
+    m_stateHistory(std::make_shared<replication::StateHistory>()),
+    m_movePredictor(std::make_shared<replication::MovePredictor>())
 {
   // Boot the CLR from the net transport's runtimeconfig (the client only needs the socket assembly).
   m_host->init("net/Transport");
@@ -41,17 +47,17 @@ ClientApp::ClientApp(ConnectOptions options)
   m_assetCache = std::make_shared<GpuAssetCache>(m_renderer, m_assetRegistry.get());
   m_renderSystem = std::make_shared<RenderSystem>();
 
+  if (m_options.interpolationDelay > 0.0f)
+  {
+    m_renderSystem->enableInterpolation(static_cast<float>(net::tickRate), m_options.interpolationDelay);
+  }
+
   m_netClient = std::make_shared<net::NetClient>(m_host);
 
   connectToServer();
 
-  // A random per-session tag so the server can echo back this client's player slot (see handlePlayerSlot).
-  std::random_device rd;
-  m_joinNonce = (static_cast<uint64_t>(rd()) << 32) ^ rd();
-
-  // Ask the server for the initial Snapshot, tagged with our nonce so the reply's slot is identifiable.
-  net::Message message(net::MessageType::join);
-  message.write(m_joinNonce);
+  // Ask the server for the initial Snapshot (and this client's player slot).
+  const net::Message message(net::MessageType::join);
   m_netClient->send(message);
 }
 
@@ -85,6 +91,8 @@ void ClientApp::run()
 
     sendInput();
 
+    predictMovement();
+
     variableUpdate();
   }
 }
@@ -136,6 +144,53 @@ void ClientApp::sendInput()
   m_netClient->send(message);
 }
 
+void ClientApp::predictMovement()
+{
+  const auto now = std::chrono::steady_clock::now();
+  const float elapsed = std::chrono::duration<float>(now - m_previousMoveTime).count();
+  m_previousMoveTime = now;
+
+  const auto player = resolvePredictedPlayer();
+  const uint32_t playerID = player ? player->getNetworkID() : 0;
+
+  if (playerID != m_predictedID)
+  {
+    m_movePredictor->reset();
+    m_predictedID = playerID;
+    m_moveAccumulator = 0.0f;
+
+    // The client moves it from here on; the deltas only correct it.
+    if (const auto interpolator = m_renderSystem->getInterpolator(); interpolator && playerID != 0)
+    {
+      interpolator->erase(playerID);
+    }
+  }
+
+  if (!player)
+  {
+    return;
+  }
+
+  const auto playerController = player->getComponent<PlayerController>(ComponentType::playerController);
+  const auto transform = player->getComponent<Transform>(ComponentType::transform);
+
+  // The server's tick, with its cap of three catch-up steps a frame, so each input moves the player here
+  // exactly as far as it will there.
+  constexpr float dt = 1.0f / net::tickRate;
+  m_moveAccumulator += elapsed;
+
+  uint8_t steps = 0;
+  while (m_moveAccumulator >= dt && steps < 3)
+  {
+    const uint8_t moveButtons = PlayerController::getMoveButtons(m_lastInputKeys);
+    const uint32_t sequence = m_movePredictor->step(*transform, *playerController, moveButtons, dt);
+    m_netClient->send(replication::buildMoveInput(sequence, moveButtons));
+
+    m_moveAccumulator -= dt;
+    ++steps;
+  }
+}
+
 void ClientApp::connectToServer()
 {
   using namespace std::chrono_literals;
@@ -234,6 +289,10 @@ void ClientApp::applyMessage(const net::Message& message) const
       handlePlayerSlot(message);
       break;
 
+    case net::MessageType::sceneStatus:
+      handleSceneStatus(message);
+      break;
+
     default: break;
   }
 }
@@ -244,6 +303,15 @@ void ClientApp::handleSnapshot(const net::Message& message) const
 
   // Full state on join: rebuild the replicated scene from the packed project blob.
   m_projectPacker->unpack(message);
+  m_stateHistory->reset();
+  m_movePredictor->reset();
+  m_predictedID = 0;
+
+  if (const auto interpolator = m_renderSystem->getInterpolator())
+  {
+    interpolator->clear();
+  }
+
   std::cerr << "[Client] Applied snapshot (" << message.size() << " bytes). Current scene: "
             << (scene ? scene->getName() : "<none>") << " ("
             << (scene ? scene->getObjectManager()->getAllObjects().size() : 0) << " objects)." << std::endl;
@@ -253,9 +321,69 @@ void ClientApp::handleStateDelta(const net::Message& message) const
 {
   const auto scene = m_sceneManager->getCurrentScene();
 
-  if (scene)
+  if (!scene)
   {
-    replication::unpackStateDelta(*scene->getObjectManager(), message);
+    return;
+  }
+
+  // Ack the tick so the server encodes the next deltas against it; a delta this view couldn't use whole
+  // goes unacked.
+  const TransformQuantizer quantizer(scene->getPhysicsSettings());
+  const auto objectManager = scene->getObjectManager();
+  const auto interpolator = m_renderSystem->getInterpolator();
+
+  const uint32_t previousTick = m_stateHistory->getTick();
+  std::vector<replication::StateEntry> entries;
+  const auto tick = replication::unpackStateDelta(*objectManager, *m_stateHistory, quantizer, message,
+                                                  interpolator ? &entries : nullptr);
+
+  // Interpolating: the delta's values go into the render buffer at its simulation tick rather than into
+  // the scene. Every accepted delta starts a tick, an empty one too: push interpolates from the tick
+  // started before, so a quiet stretch must still move it on, or a body that starts moving after one
+  // would be blended across the whole gap.
+  if (interpolator && tick)
+  {
+    interpolator->beginTick(replication::readSimulationTick(message));
+
+    for (const auto& entry : entries)
+    {
+      const auto transform = objectManager->getObjectByNetworkID(entry.networkID)
+        ->getComponent<Transform>(ComponentType::transform);
+
+      // The predicted player isn't rendered from the past: it takes rotation and scale as they come, and its
+      // position from the reconciliation below.
+      if (entry.networkID == m_predictedID)
+      {
+        transform->setRotation(entry.rotation);
+        transform->setScale(entry.scale);
+        continue;
+      }
+
+      interpolator->push(entry.networkID,
+                         { entry.position, entry.rotation, entry.scale },
+                         { transform->getLocalPosition(), transform->getLocalRotation(), transform->getLocalScale() });
+    }
+  }
+
+  // Rebase the predicted player on where the server had it this tick, after the last of our inputs it had
+  // applied, and replay the rest on top.
+  if (m_predictedID != 0 && m_stateHistory->getTick() != previousTick)
+  {
+    const auto player = objectManager->getObjectByNetworkID(m_predictedID);
+    const auto state = m_stateHistory->getState(m_predictedID, m_stateHistory->getTick());
+
+    if (player && state)
+    {
+      m_movePredictor->reconcile(*player->getComponent<Transform>(ComponentType::transform),
+                                 *player->getComponent<PlayerController>(ComponentType::playerController),
+                                 replication::readMoveSequence(message), quantizer.getPosition(*state),
+                                 1.0f / net::tickRate);
+    }
+  }
+
+  if (tick)
+  {
+    m_netClient->send(replication::buildStateAck(tick));
   }
 }
 
@@ -288,15 +416,15 @@ void ClientApp::handleObjectDestroyed(const net::Message& message) const
 
 void ClientApp::handlePlayerSlot(const net::Message& message) const
 {
-  // The server broadcasts every client's slot assignment; keep only the one tagged with our own nonce.
+  // Sent to this connection alone, in reply to its join.
   net::MessageReader reader(message);
-  const auto nonce = reader.read<uint64_t>();
-  const auto slot = reader.read<int32_t>();
+  m_playerSlot = reader.read<int32_t>();
+}
 
-  if (nonce == m_joinNonce)
-  {
-    m_playerSlot = slot;
-  }
+void ClientApp::handleSceneStatus(const net::Message& message) const
+{
+  net::MessageReader reader(message);
+  m_sceneRunning = reader.read<SceneStatus>() == SceneStatus::running;
 }
 
 std::optional<uuids::uuid> ClientApp::resolvePlayerCamera() const
@@ -329,3 +457,35 @@ std::optional<uuids::uuid> ClientApp::resolvePlayerCamera() const
 
   return std::nullopt;
 }
+
+std::shared_ptr<Object> ClientApp::resolvePredictedPlayer() const
+{
+  if (!m_options.prediction || !m_sceneRunning || m_playerSlot < 0)
+  {
+    return nullptr;
+  }
+
+  const auto scene = m_sceneManager->getCurrentScene();
+  if (!scene)
+  {
+    return nullptr;
+  }
+
+  for (const auto& object : scene->getObjectManager()->getAllObjects())
+  {
+    const auto playerController = object->getComponent<PlayerController>(ComponentType::playerController);
+    if (!playerController || playerController->getPlayerSlot() != m_playerSlot
+        || playerController->getMoveSpeed() == 0.0f)
+    {
+      continue;
+    }
+
+    if (const auto transform = object->getComponent<Transform>(ComponentType::transform);
+        transform && transform->getOwner() == object.get())
+    {
+      return object;
+    }
+  }
+
+  return nullptr;
+}
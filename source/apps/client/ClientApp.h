@@ -2,6 +2,7 @@
 #define CLIENTAPP_H
 
 #include <Protocol.h>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -19,6 +20,12 @@ class SceneManager;
 class ProjectPacker;
 class GpuAssetCache;
 class RenderSystem;
+class Object;
+
+namespace replication {
+  class StateHistory;
+  class MovePredictor;
+}
 
 namespace net {
   class NetClient;
@@ -35,6 +42,12 @@ public:
     int port = net::defaultPort;
     bool launchLocalServer = false;
     std::string project;
+    // How far (seconds) behind the server's state stream replicated objects are rendered, interpolated
+    // between its ticks; enough to cover a delta or two of jitter. 0 applies each delta as it lands.
+    float interpolationDelay = 0.1f;
+    // Move this client's player ahead of the server when its PlayerController has built-in movement,
+    // rather than a round trip behind; the server's deltas correct it.
+    bool prediction = true;
   };
 
   explicit ClientApp(ConnectOptions options);
@@ -57,6 +70,10 @@ private:
   std::shared_ptr<SceneManager> m_sceneManager;
   std::shared_ptr<ProjectPacker> m_projectPacker;
 
+  // What each state delta gave this view, per tick: the baselines the server encodes later deltas against
+  // once they're acked. Cleared with every snapshot.
+  std::shared_ptr<replication::StateHistory> m_stateHistory;
+
   std::shared_ptr<vke::VulkanEngine> m_renderer;
   std::shared_ptr<GpuAssetCache> m_assetCache;
   std::shared_ptr<RenderSystem> m_renderSystem;
@@ -70,19 +87,30 @@ private:
   float m_lastMouseY = 0.0f;
   bool m_inputSent = false;
 
-  // A per-session random tag sent in join; the server echoes it back in a playerSlot message so this
-  // client can pick out its own slot assignment from the broadcast.
-  uint64_t m_joinNonce = 0;
   // The player slot the server bound this client to (-1 until the playerSlot message arrives). Drives
   // which object's Camera the client renders through. mutable: set from the const message-apply path.
   mutable int32_t m_playerSlot = -1;
 
+  // Only predict while the server's scene runs - it doesn't move anything otherwise. mutable: set from the
+  // const message-apply path.
+  mutable bool m_sceneRunning = false;
+
+  // The player object being predicted (network id, 0 for none) and its inputs in flight. The prediction
+  // runs on the server's fixed tick, not the frame.
+  mutable uint32_t m_predictedID = 0;
+  std::shared_ptr<replication::MovePredictor> m_movePredictor;
+  std::chrono::steady_clock::time_point m_previousMoveTime;
+  float m_moveAccumulator = 0.0f;
+
   void createRenderer();
 
   void connectToServer();
 
   void sendInput();
 
+  // Step the predicted player for every tick due since the last frame, sending each tick's moveInput.
+  void predictMovement();
+
   void variableUpdate() const;
 
   void applyMessage(const net::Message& message) const;
@@ -99,10 +127,16 @@ private:
 
   void handlePlayerSlot(const net::Message& message) const;
 
+  void handleSceneStatus(const net::Message& message) const;
+
   // The object this client should render through: the one carrying a PlayerController for this client's
   // player slot and a Camera. nullopt when the slot is still unknown or no such camera exists - the
   // caller then falls back to the scene's first active camera / free-fly (RenderSystem::updateCamera).
   [[nodiscard]] std::optional<uuids::uuid> resolvePlayerCamera() const;
+
+  // The object whose movement this client predicts: the one carrying a PlayerController for this client's
+  // slot with built-in movement, and its own Transform. nullptr when prediction is off or doesn't apply.
+  [[nodiscard]] std::shared_ptr<Object> resolvePredictedPlayer() const;
 };
 
 
@@ -26,6 +26,15 @@ int main(const int argc, char** argv)
       {
         options.project = argv[++i];
       }
+      else if (arg == "--interp-delay" && i + 1 < argc)
+      {
+        // Milliseconds; 0 turns interpolation off.
+        options.interpolationDelay = std::stof(argv[++i]) / 1000.0f;
+      }
+      else if (arg == "--no-prediction")
+      {
+        options.prediction = false;
+      }
     }
 
     ClientApp app(options);
@@ -0,0 +1,181 @@
+#include "DefaultProject.h"
+#include <ComponentRegistry.h>
+#include <ComponentRegistration.h>
+#include <ProjectSerializer.h>
+#include <assets/AssetRegistry.h>
+#include <scenes/SceneAsset.h>
+#include <scenes/SceneManager.h>
+#include <PhysicsSystem.h>
+#include <CollisionSystem.h>
+#include <SimulationHash.h>
+#include <JobSystem.h>
+#include <Protocol.h>
+#include <nlohmann/json.hpp>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+#include <uuid.h>
+
+// Determinism check for the server's --deterministic mode: loads the sample project from a fixed seed,
+// steps every scene through the server's per-tick physics (minus the scripts), and hashes the simulated
+// state (hashSimulationState) after every tick. It does so three times - twice on the full worker pool,
+// once on a single worker - and fails on the first scene and tick where a run's hash differs from the
+// first run's.
+namespace {
+
+struct SceneTrace {
+  std::string name;
+  std::vector<uint64_t> hashes;
+};
+
+// By scene uuid: seeded, so the same across runs.
+using Trace = std::map<std::string, SceneTrace>;
+
+Trace simulate(const uint32_t seed, const uint32_t ticks)
+{
+  const auto componentRegistry = std::make_shared<ComponentRegistry>();
+  registerDataComponents(*componentRegistry);
+
+  AssetRegistry assetRegistry;
+  SceneManager sceneManager;
+  const ProjectSerializer projectSerializer(&assetRegistry, &sceneManager, componentRegistry);
+  projectSerializer.deserialize(buildDefaultProject(seed));
+
+  constexpr float dt = 1.0f / net::tickRate;
+
+  Trace trace;
+  for (const auto& scene : sceneManager.getScenes() | std::views::values)
+  {
+    auto& objectManager = *scene->getObjectManager();
+
+    CollisionSystem collisionSystem;
+    collisionSystem.setDeterministic(true);
+    collisionSystem.setLayerMatrix(scene->getPhysicsSettings().layerMatrix);
+
+    const uint32_t substeps = scene->getPhysicsSettings().substeps;
+    const float stepFraction = 1.0f / static_cast<float>(substeps);
+
+    auto& sceneTrace = trace[uuids::to_string(scene->getUUID())];
+    sceneTrace.name = scene->getName();
+    sceneTrace.hashes.reserve(ticks);
+
+    scene->start();
+
+    for (uint32_t tick = 0; tick < ticks; ++tick)
+    {
+      for (uint32_t step = 0; step < substeps; ++step)
+      {
+        PhysicsSystem::fixedUpdate(objectManager, dt * stepFraction, &collisionSystem, stepFraction);
+        collisionSystem.fixedUpdate(objectManager);
+      }
+      collisionSystem.commitEvents();
+
+      sceneTrace.hashes.push_back(hashSimulationState(objectManager));
+    }
+
+    scene->stop();
+  }
+
+  return trace;
+}
+
+// Reports the first tick each scene diverges at; true when none does.
+bool matches(const Trace& expected, const Trace& actual, const std::string& run)
+{
+  if (expected.size() != actual.size())
+  {
+    std::cerr << std::format("{}: {} scene(s), expected {}.", run, actual.size(), expected.size()) << std::endl;
+    return false;
+  }
+
+  bool same = true;
+  for (const auto& [uuid, scene] : expected)
+  {
+    const auto other = actual.find(uuid);
+    if (other == actual.end())
+    {
+      std::cerr << std::format("{}: scene '{}' missing.", run, scene.name) << std::endl;
+      same = false;
+      continue;
+    }
+
+    const auto& hashes = other->second.hashes;
+    for (size_t tick = 0; tick < scene.hashes.size(); ++tick)
+    {
+      if (tick >= hashes.size() || hashes[tick] != scene.hashes[tick])
+      {
+        std::cerr << std::format("{}: scene '{}' diverged at tick {}: {:016x}, expected {:016x}.", run,
+          scene.name, tick + 1, tick < hashes.size() ? hashes[tick] : 0, scene.hashes[tick]) << std::endl;
+        same = false;
+        break;
+      }
+    }
+  }
+
+  return same;
+}
+
+}
+
+int main(const int argc, char** argv)
+{
+  try
+  {
+    uint32_t ticks = 500;
+    uint32_t seed = 0;
+    uint32_t workers = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      if (arg == "--ticks" && i + 1 < argc)
+      {
+        ticks = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--seed" && i + 1 < argc)
+      {
+        seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--workers" && i + 1 < argc)
+      {
+        workers = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+    }
+
+    JobSystem::configure(workers);
+    const auto first = simulate(seed, ticks);
+    const auto second = simulate(seed, ticks);
+
+    JobSystem::configure(1);
+    const auto single = simulate(seed, ticks);
+
+    JobSystem::shutdown();
+
+    const bool rerunMatches = matches(first, second, "Rerun");
+    const bool singleMatches = matches(first, single, "Single worker");
+
+    for (const auto& scene : first | std::views::values)
+    {
+      std::cout << std::format("Scene '{}': {} ticks, final state hash {:016x}.", scene.name, scene.hashes.size(),
+        scene.hashes.empty() ? 0 : scene.hashes.back()) << std::endl;
+    }
+
+    if (!rerunMatches || !singleMatches)
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    JobSystem::shutdown();
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
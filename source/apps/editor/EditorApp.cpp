@@ -4,6 +4,8 @@
 #include <ProjectSerializer.h>
 #include <ProjectPacker.h>
 #include <Replication.h>
+#include <StateHistory.h>
+#include <TransformQuantizer.h>
 #include <assets/AssetRegistry.h>
 #include <scenes/SceneManager.h>
 #include <scenes/SceneAsset.h>
@@ -121,7 +123,8 @@ EditorApp::EditorApp(LaunchOptions options)
     m_host(std::make_shared<ManagedHost>()),
     m_componentRegistry(std::make_shared<ComponentRegistry>()),
     m_assetRegistry(std::make_shared<AssetRegistry>()),
-    m_sceneManager(std::make_shared<SceneManager>())
+    m_sceneManager(std::make_shared<SceneManager>()),
+    m_stateHistory(std::make_shared<replication::StateHistory>())
 {
   // Boot the CLR from the net transport's runtimeconfig (the editor only needs the socket assembly;
   // scripts run on the spawned --edit server).
@@ -204,9 +207,17 @@ EditorApp::EditorApp(LaunchOptions options)
     return count;
   };
 
-  // A component value edit: send the component's new state to the server. Only the Inspector fires this.
+  // A component value edit: send the component's new state to the server, naming the object by the network
+  // id the snapshot gave it. Only the Inspector fires this.
   const auto editComponent = [this](const uuids::uuid& objectUUID, const std::shared_ptr<Component>& component) {
-    const auto message = replication::buildComponentEdit(objectUUID, component);
+    const auto scene = m_sceneManager->getCurrentScene();
+    const auto object = scene ? scene->getObjectManager()->getObjectByUUID(objectUUID) : nullptr;
+    if (!object)
+    {
+      return;
+    }
+
+    const auto message = replication::buildComponentEdit(object->getNetworkID(), component);
     m_netClient->send(message);
   };
 
@@ -216,10 +227,7 @@ EditorApp::EditorApp(LaunchOptions options)
     const auto payload = edit.dump();
 
     net::Message message(net::MessageType::sceneEdit);
-    for (const std::vector<uint8_t> chunks(payload.begin(), payload.end()); const auto& chunk : chunks)
-    {
-      message.write(chunk);
-    }
+    message.writeBytes({ reinterpret_cast<const uint8_t*>(payload.data()), payload.size() });
     m_netClient->send(message);
   };
 
@@ -523,7 +531,7 @@ void EditorApp::registerEditors() const
   registerRigidBodyEditor(*m_componentEditor);
   registerModelRendererEditor(*m_componentEditor, m_assetCache, m_assetRegistry.get());
   registerLightRendererEditor(*m_componentEditor);
-  registerColliderEditors(*m_componentEditor);
+  registerColliderEditors(*m_componentEditor, m_assetRegistry.get());
   registerScriptEditor(*m_componentEditor);
   registerPlayerControllerEditor(*m_componentEditor);
   registerCameraEditor(*m_componentEditor);
@@ -584,6 +592,7 @@ void EditorApp::handleSnapshot(const net::Message& message) const
 {
   // Full state on join: rebuild the replicated scene from the packed project blob.
   m_projectPacker->unpack(message);
+  m_stateHistory->reset();
 
   const auto scene = m_sceneManager->getCurrentScene();
   std::cerr << "[Editor] Applied snapshot (" << message.size() << " bytes). Current scene: "
@@ -593,9 +602,16 @@ void EditorApp::handleSnapshot(const net::Message& message) const
 
 void EditorApp::handleStateDelta(const net::Message& message) const
 {
-  if (const auto scene = m_sceneManager->getCurrentScene())
+  const auto scene = m_sceneManager->getCurrentScene();
+  if (!scene)
+  {
+    return;
+  }
+
+  const TransformQuantizer quantizer(scene->getPhysicsSettings());
+  if (const auto tick = replication::unpackStateDelta(*scene->getObjectManager(), *m_stateHistory, quantizer, message))
   {
-    replication::unpackStateDelta(*scene->getObjectManager(), message);
+    m_netClient->send(replication::buildStateAck(tick));
   }
 }
 
@@ -30,6 +30,10 @@ class AssetBrowserPanel;
 class SaveUI;
 class EditorSelection;
 
+namespace replication {
+  class StateHistory;
+}
+
 namespace net {
   class NetClient;
   class ServerProcess;
@@ -78,6 +82,10 @@ private:
   std::shared_ptr<ProjectSerializer> m_projectSerializer;
   std::shared_ptr<ProjectPacker> m_projectPacker;
 
+  // What each state delta gave this view, per tick, for the server to encode later deltas against once
+  // acked. Cleared with every snapshot.
+  std::shared_ptr<replication::StateHistory> m_stateHistory;
+
   std::shared_ptr<vke::VulkanEngine> m_renderer;
   std::shared_ptr<GpuAssetCache> m_assetCache;
   std::shared_ptr<RenderSystem> m_renderSystem;
@@ -0,0 +1,226 @@
+#include "NetBench.h"
+#include <MessageQueue.h>
+#include <PayloadPool.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <latch>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using nlohmann::json;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsBetween(const Clock::time_point start, const Clock::time_point end)
+{
+  return std::chrono::duration<double>(end - start).count();
+}
+
+// The inbox as it was: a fresh payload per message, one mutex around a std::queue, and the tick taking a
+// message per lock.
+class LockedQueue {
+public:
+  static constexpr auto name = "mutex";
+
+  void enqueue(const int32_t connId, const uint8_t type, const uint8_t* data, const int32_t len)
+  {
+    net::Message message(static_cast<net::MessageType>(type), std::vector(data, data + len));
+
+    std::lock_guard lock(m_mutex);
+    m_messages.push({ std::move(message), connId });
+  }
+
+  size_t drain(std::vector<net::MessageQueue::Entry>& entries)
+  {
+    entries.clear();
+    size_t taken = 0;
+
+    while (true)
+    {
+      std::lock_guard lock(m_mutex);
+      if (m_messages.empty())
+      {
+        return taken;
+      }
+
+      entries.push_back(std::move(m_messages.front()));
+      m_messages.pop();
+      ++taken;
+    }
+  }
+
+private:
+  std::mutex m_mutex;
+  std::queue<net::MessageQueue::Entry> m_messages;
+};
+
+// The inbox as it is: NetServer::enqueue and NetServer::drain, the payloads going round the pool.
+class LockFreeQueue {
+public:
+  static constexpr auto name = "lockFree";
+
+  void enqueue(const int32_t connId, const uint8_t type, const uint8_t* data, const int32_t len)
+  {
+    auto payload = m_payloads.acquire();
+    payload.assign(data, data + len);
+
+    m_queue.push(net::Message(static_cast<net::MessageType>(type), std::move(payload)), connId);
+  }
+
+  size_t drain(std::vector<net::MessageQueue::Entry>& entries)
+  {
+    for (auto& entry : entries)
+    {
+      m_payloads.release(entry.message.releasePayload());
+    }
+
+    entries.clear();
+    return m_queue.drain(entries);
+  }
+
+private:
+  net::PayloadPool m_payloads;
+  net::MessageQueue m_queue;
+};
+
+struct RunResult {
+  double seconds = 0.0;
+  double pushNanoseconds = 0.0;
+  double meanBatch = 0.0;
+  bool ordered = true;
+};
+
+}
+
+NetBench::NetBench(const Options options)
+  : m_options(options)
+{}
+
+json NetBench::run() const
+{
+  return {
+    { "producers", m_options.producers },
+    { "messagesPerProducer", m_options.messagesPerProducer },
+    { "payloadBytes", m_options.payloadBytes },
+    { "hardwareThreads", std::thread::hardware_concurrency() },
+    { "queues", json::array({ benchQueue<LockedQueue>(), benchQueue<LockFreeQueue>() }) }
+  };
+}
+
+template <typename Queue>
+json NetBench::benchQueue() const
+{
+  const uint32_t producers = std::max(m_options.producers, 1u);
+  const uint32_t perProducer = m_options.messagesPerProducer;
+  const uint64_t total = static_cast<uint64_t>(producers) * perProducer;
+
+  // Producer id and sequence lead the payload; the rest is padding up to payloadBytes.
+  constexpr size_t headerBytes = 2 * sizeof(uint32_t);
+  const size_t frameBytes = std::max<size_t>(m_options.payloadBytes, headerBytes);
+
+  std::vector<RunResult> runs;
+
+  for (uint32_t runIndex = 0; runIndex < std::max(m_options.runs, 1u); ++runIndex)
+  {
+    Queue queue;
+    RunResult result;
+
+    std::latch ready(producers + 1);
+    std::vector<double> pushSeconds(producers);
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+
+    for (uint32_t producer = 0; producer < producers; ++producer)
+    {
+      threads.emplace_back([&, producer] {
+        ready.arrive_and_wait();
+
+        // The frame as the transport hands it over: raw bytes, copied in by enqueue.
+        std::vector<uint8_t> frame(frameBytes);
+        std::memcpy(frame.data(), &producer, sizeof(producer));
+
+        const auto start = Clock::now();
+        for (uint32_t sequence = 0; sequence < perProducer; ++sequence)
+        {
+          std::memcpy(frame.data() + sizeof(producer), &sequence, sizeof(sequence));
+
+          queue.enqueue(static_cast<int32_t>(producer), static_cast<uint8_t>(net::MessageType::inputState),
+                        frame.data(), static_cast<int32_t>(frame.size()));
+        }
+        pushSeconds[producer] = secondsBetween(start, Clock::now());
+      });
+    }
+
+    std::vector<uint32_t> expected(producers, 0);
+    std::vector<net::MessageQueue::Entry> entries;
+    uint64_t received = 0;
+    uint64_t batches = 0;
+
+    ready.arrive_and_wait();
+    const auto start = Clock::now();
+
+    while (received < total)
+    {
+      if (queue.drain(entries) == 0)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+
+      ++batches;
+      received += entries.size();
+
+      for (const auto& entry : entries)
+      {
+        net::MessageReader reader(entry.message);
+        const auto producer = reader.read<uint32_t>();
+        const auto sequence = reader.read<uint32_t>();
+
+        if (producer >= producers || sequence != expected[producer]++)
+        {
+          result.ordered = false;
+        }
+      }
+    }
+
+    result.seconds = secondsBetween(start, Clock::now());
+
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    double pushTotal = 0.0;
+    for (const auto seconds : pushSeconds)
+    {
+      pushTotal += seconds;
+    }
+
+    result.pushNanoseconds = total > 0 ? pushTotal / static_cast<double>(total) * 1e9 : 0.0;
+    result.meanBatch = batches > 0 ? static_cast<double>(received) / static_cast<double>(batches) : 0.0;
+    result.ordered = result.ordered && std::ranges::all_of(expected, [perProducer](const uint32_t next) {
+      return next == perProducer;
+    });
+
+    runs.push_back(result);
+  }
+
+  std::ranges::sort(runs, {}, &RunResult::seconds);
+  const auto& median = runs[runs.size() / 2];
+
+  return {
+    { "queue", Queue::name },
+    { "bestSeconds", runs.front().seconds },
+    { "medianSeconds", median.seconds },
+    { "messagesPerSecond", median.seconds > 0.0 ? static_cast<double>(total) / median.seconds : 0.0 },
+    { "pushNanoseconds", median.pushNanoseconds },
+    { "meanBatch", median.meanBatch },
+    { "ordered", std::ranges::all_of(runs, &RunResult::ordered) }
+  };
+}
@@ -0,0 +1,38 @@
+#ifndef NETBENCH_H
+#define NETBENCH_H
+
+#include <nlohmann/json_fwd.hpp>
+#include <cstdint>
+
+// Inbox contention benchmark: many producer threads (standing in for the transport's socket threads)
+// enqueue small frames, as clients streaming inputState do, while one consumer (standing in for the tick)
+// drains them. Runs the inbox's real path (NetServer::enqueue's pooled copy into the lock-free
+// net::MessageQueue, and NetServer::drain handing the payloads back) against what the inbox was - a fresh
+// payload per message into a mutex-guarded queue popped a message per lock - and reports throughput,
+// producer enqueue times and the consumer's batches as JSON. Every run checks each producer's messages
+// arrive complete and in order.
+class NetBench {
+public:
+  struct Options {
+    uint32_t producers = 64;
+    uint32_t messagesPerProducer = 20000;
+    // inputState-sized: a few keys and the mouse block.
+    uint32_t payloadBytes = 48;
+    // Runs per queue; the report keeps the best and the median.
+    uint32_t runs = 5;
+  };
+
+  explicit NetBench(Options options);
+
+  [[nodiscard]] nlohmann::json run() const;
+
+private:
+  Options m_options;
+
+  template <typename Queue>
+  [[nodiscard]] nlohmann::json benchQueue() const;
+};
+
+
+
+#endif //NETBENCH_H
@@ -0,0 +1,66 @@
+#include "NetBench.h"
+#include <nlohmann/json.hpp>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+  try
+  {
+    // 64 producers by default. The report goes to stdout (or --output) so CI can archive and diff it.
+    NetBench::Options options;
+    std::string output;
+
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      if (arg == "--producers" && i + 1 < argc)
+      {
+        options.producers = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--messages" && i + 1 < argc)
+      {
+        options.messagesPerProducer = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--payload" && i + 1 < argc)
+      {
+        options.payloadBytes = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--runs" && i + 1 < argc)
+      {
+        options.runs = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--output" && i + 1 < argc)
+      {
+        output = argv[++i];
+      }
+    }
+
+    const NetBench bench(options);
+    const auto report = bench.run().dump(2);
+
+    if (output.empty())
+    {
+      std::cout << report << std::endl;
+    }
+    else
+    {
+      std::ofstream file(output);
+      if (!file)
+      {
+        throw std::runtime_error("Could not write '" + output + "'.");
+      }
+
+      file << report << std::endl;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+#include <TransformQuantizer.h>
+#include <scenes/PhysicsSettings.h>
+#include <Protocol.h>
+#include <glm/vec3.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+
+// Round-trip check for the state delta's transform encoding: random local transforms go through
+// TransformQuantizer::quantize, write (in full, and against the previous one as the baseline) and read,
+// at several position precisions. Fails unless every position comes back within half a grid step per axis,
+// every rotation within 180/65536 degrees of the same orientation, scale exactly, and a position outside
+// the replication bounds bit for bit (the float fallback).
+namespace {
+
+// Each check reports its first failure only, so a broken encoder doesn't flood the log. The message is
+// only built for that one.
+class Checker {
+public:
+  template <typename Describe>
+  void expect(const bool condition, Describe&& describe)
+  {
+    if (!condition && m_failures++ == 0)
+    {
+      std::cerr << describe() << std::endl;
+    }
+  }
+
+  [[nodiscard]] uint64_t getFailures() const { return m_failures; }
+
+private:
+  uint64_t m_failures = 0;
+};
+
+// The short way between two angles, in degrees.
+double angleBetween(const double a, const double b)
+{
+  const double turn = std::fmod(std::abs(a - b), 360.0);
+  return std::min(turn, 360.0 - turn);
+}
+
+std::optional<QuantizedTransform> roundTrip(const TransformQuantizer& quantizer, const QuantizedTransform& transform,
+                                            const QuantizedTransform* baseline)
+{
+  net::Message message(net::MessageType::stateDelta);
+  quantizer.write(message, transform, baseline);
+
+  net::MessageReader reader(message);
+  return quantizer.read(reader, baseline);
+}
+
+uint64_t checkPrecision(const float precision, const uint32_t samples, std::mt19937& engine)
+{
+  PhysicsSettings settings;
+  settings.positionPrecision = precision;
+  const TransformQuantizer quantizer(settings);
+
+  // Half a grid step, which is the precision unless four bytes can't count that many (as the quantizer
+  // sizes it), plus what rounding the result to a float can add at the bounds' edge.
+  const double range = static_cast<double>(settings.replicationBoundsMax.x) - settings.replicationBoundsMin.x;
+  const double steps = std::min(std::ceil(range / precision), static_cast<double>(std::numeric_limits<uint32_t>::max()));
+  const double step = range / steps;
+  const float edge = std::max(std::abs(settings.replicationBoundsMin.x), std::abs(settings.replicationBoundsMax.x));
+  const double positionBound = 0.5 * step + edge * std::numeric_limits<float>::epsilon();
+  const double rotationBound = 180.0 / 65536.0 + 1000.0 * std::numeric_limits<float>::epsilon();
+
+  std::uniform_real_distribution position(settings.replicationBoundsMin.x, settings.replicationBoundsMax.x);
+  std::uniform_real_distribution rotation(-1000.0f, 1000.0f);
+  std::uniform_real_distribution scale(0.01f, 100.0f);
+
+  Checker checker;
+  double worstPosition = 0.0;
+  double worstRotation = 0.0;
+  QuantizedTransform previous = quantizer.quantize(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+
+  for (uint32_t i = 0; i < samples; ++i)
+  {
+    const glm::vec3 inPosition(position(engine), position(engine), position(engine));
+    const glm::vec3 inRotation(rotation(engine), rotation(engine), rotation(engine));
+    const glm::vec3 inScale(scale(engine), scale(engine), scale(engine));
+
+    const auto quantized = quantizer.quantize(inPosition, inRotation, inScale);
+    checker.expect(!quantized.floatPosition, [&] {
+      return std::format("precision {}: in-bounds position fell back to floats", precision);
+    });
+
+    const auto full = roundTrip(quantizer, quantized, nullptr);
+    const auto relative = roundTrip(quantizer, quantized, &previous);
+    checker.expect(full && *full == quantized, [&] {
+      return std::format("precision {}: full entry didn't round-trip", precision);
+    });
+    checker.expect(relative && *relative == quantized, [&] {
+      return std::format("precision {}: entry against a baseline didn't round-trip", precision);
+    });
+    previous = quantized;
+
+    const auto outPosition = quantizer.getPosition(quantized);
+    const auto outRotation = TransformQuantizer::getRotation(quantized);
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double positionError = std::abs(static_cast<double>(outPosition[axis]) - inPosition[axis]);
+      const double rotationError = angleBetween(outRotation[axis], inRotation[axis]);
+
+      checker.expect(positionError <= positionBound, [&] {
+        return std::format("precision {}: position {} came back {} (off {})", precision, inPosition[axis],
+                           outPosition[axis], positionError);
+      });
+      checker.expect(rotationError <= rotationBound, [&] {
+        return std::format("precision {}: rotation {} came back {} (off {})", precision, inRotation[axis],
+                           outRotation[axis], rotationError);
+      });
+      checker.expect(outRotation[axis] >= -180.0f && outRotation[axis] < 180.0f, [&] {
+        return std::format("precision {}: rotation {} came back unwrapped as {}", precision, inRotation[axis],
+                           outRotation[axis]);
+      });
+
+      worstPosition = std::max(worstPosition, positionError);
+      worstRotation = std::max(worstRotation, rotationError);
+    }
+
+    checker.expect(quantized.scale == inScale, [&] {
+      return std::format("precision {}: scale isn't exact", precision);
+    });
+  }
+
+  // Outside the bounds (and NaN, which fits no bounds): the raw floats, exactly.
+  const float outside = settings.replicationBoundsMax.x * 4.0f;
+  for (const glm::vec3 inPosition : { glm::vec3(outside, 0.0f, 0.0f), glm::vec3(0.0f, -outside, 0.0f),
+                                      glm::vec3(0.0f, 0.0f, std::numeric_limits<float>::quiet_NaN()) })
+  {
+    const auto quantized = quantizer.quantize(inPosition, glm::vec3(0.0f), glm::vec3(1.0f));
+    checker.expect(quantized.floatPosition, [&] {
+      return std::format("precision {}: out-of-bounds position stayed on the grid", precision);
+    });
+
+    const auto full = roundTrip(quantizer, quantized, nullptr);
+    const auto relative = roundTrip(quantizer, quantized, &previous);
+    checker.expect(full && *full == quantized && relative && *relative == quantized, [&] {
+      return std::format("precision {}: float position didn't round-trip", precision);
+    });
+
+    const auto outPosition = quantizer.getPosition(quantized);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      checker.expect(std::bit_cast<uint32_t>(outPosition[axis]) == std::bit_cast<uint32_t>(inPosition[axis]), [&] {
+        return std::format("precision {}: float position {} came back {}", precision, inPosition[axis],
+                           outPosition[axis]);
+      });
+    }
+  }
+
+  std::cout << std::format("Precision {}: {} byte(s) per axis, worst position error {:.3g} (bound {:.3g}), "
+    "worst rotation error {:.3g} degrees (bound {:.3g}), {} failure(s).", precision, quantizer.getPositionBytes(),
+    worstPosition, positionBound, worstRotation, rotationBound, checker.getFailures()) << std::endl;
+
+  return checker.getFailures();
+}
+
+}
+
+int main(const int argc, char** argv)
+{
+  uint32_t samples = 200000;
+  uint32_t seed = 1;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--samples" && i + 1 < argc)
+    {
+      samples = static_cast<uint32_t>(std::stoul(argv[++i]));
+    }
+    else if (arg == "--seed" && i + 1 < argc)
+    {
+      seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+    }
+  }
+
+  std::mt19937 engine(seed);
+
+  uint64_t failures = 0;
+  for (const float precision : { 0.001f, 0.01f, 0.5f, 1e-7f })
+  {
+    failures += checkPrecision(precision, samples, engine);
+  }
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
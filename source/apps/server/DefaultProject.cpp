@@ -1,4 +1,5 @@
 #include "DefaultProject.h"
+#include <objects/ObjectManager.h>
 #include <nlohmann/json.hpp>
 #include <glm/vec3.hpp>
 #include <glm/geometric.hpp>
@@ -25,12 +26,30 @@ const std::string rigidBlockPrefab = "3f8c1a47-92d5-4e08-b1a6-5c7e09f4d2b1";
 const std::string spherePrefab = "6d2b4f19-08ac-4d73-9e52-b83a1c6f0e47";
 const std::string playerPrefab = "9c7f0e83-4d16-4b52-a09e-27f5b3d81c6a";
 
-std::string newUUID()
+// One engine for every random draw (object uuids and the procedural placements), so seeding it makes the
+// whole project reproducible. Draws use the engine's raw output only: mt19937 is specified bit for bit, the
+// std distributions aren't, and a seeded project has to come out the same on every server.
+std::mt19937& randomEngine()
 {
   static std::mt19937 gen{ std::random_device{}() };
-  static uuids::uuid_random_generator generator{ gen };
+  return gen;
+}
+
+// Uniform in [min, max), from the top 24 bits of one draw (a float's whole mantissa).
+float randomFloat(const float min, const float max)
+{
+  const float unit = static_cast<float>(randomEngine()() >> 8) * 0x1p-24f;
+  return min + (max - min) * unit;
+}
+
+bool randomBool()
+{
+  return (randomEngine()() >> 31) != 0;
+}
 
-  return uuids::to_string(generator());
+std::string newUUID()
+{
+  return uuids::to_string(ObjectManager::drawUUID(randomEngine()));
 }
 
 json vec(const glm::vec3& v)
@@ -133,46 +152,41 @@ json makeObject(const std::string& name, json components, json scripts = json::a
 //
 // Each is one serialized object at the identity transform, defined exactly once. They are registered as
 // real Prefab assets (see buildDefaultProject) AND are what the scenes below instantiate, so the default
-// project both ships a browsable/spawnable prefab set and eats its own dog food.
+// project both ships a browsable/spawnable prefab set and eats its own dog food. Built afresh on each call
+// rather than cached, so every buildDefaultProject draws the same uuids from the same seed.
 
-const json& blockBody()
+json blockBody()
 {
-  static const json body = makeObject("Block", json::array({
+  return makeObject("Block", json::array({
     transform(glm::vec3(0)),
     modelRenderer(cubeModel, whiteTexture, whiteTexture),
     rigidBody(),
     boxCollider()
   }));
-
-  return body;
 }
 
-const json& rigidBlockBody()
+json rigidBlockBody()
 {
-  static const json body = makeObject("Rigid Block", json::array({
+  return makeObject("Rigid Block", json::array({
     transform(glm::vec3(0)),
     modelRenderer(cubeModel, whiteTexture, whiteTexture),
     boxCollider()
   }));
-
-  return body;
 }
 
-const json& sphereBody()
+json sphereBody()
 {
-  static const json body = makeObject("Sphere", json::array({
+  return makeObject("Sphere", json::array({
     transform(glm::vec3(0)),
     modelRenderer(sphereModel, earthTexture, earthSpecularTexture),
     rigidBody(),
     sphereCollider()
   }));
-
-  return body;
 }
 
-const json& playerBody()
+json playerBody()
 {
-  static const json body = makeObject("Player", json::array({
+  return makeObject("Player", json::array({
     transform(glm::vec3(0)),
     modelRenderer(playerModel, whiteTexture, whiteTexture),
     rigidBody(),
@@ -189,8 +203,6 @@ const json& playerBody()
       })}
     }
   }));
-
-  return body;
 }
 
 json prefabAsset(const std::string& name, const std::string& uuid, const json& body)
@@ -342,13 +354,6 @@ json buildScene3()
     rigidBlock({ 0, -9, 0 }, { 100, 10, 100 })
   });
 
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<float> dist(-0.75f, 0.75f);
-  std::uniform_real_distribution<float> sphereSize(0.25f, 1.5f);
-  std::uniform_int_distribution<int> shouldUseSphere(0, 1);
-  std::uniform_real_distribution<float> rot(0.0f, 360.0f);
-
   for (int i = 0; i < gridHeight; i++)
   {
     for (int j = 0; j < gridSize; j++)
@@ -358,20 +363,22 @@ json buildScene3()
         constexpr float bottomY = 6.0f;
         constexpr float offsetXZ = (gridSize - 1) * ballSpacing / 2.0f;
 
-        const float x = static_cast<float>(j) * ballSpacing + dist(gen) - offsetXZ;
+        const float x = static_cast<float>(j) * ballSpacing + randomFloat(-0.75f, 0.75f) - offsetXZ;
         const float y = static_cast<float>(i) * ballSpacing + bottomY;
-        const float z = static_cast<float>(k) * ballSpacing + dist(gen) - offsetXZ;
+        const float z = static_cast<float>(k) * ballSpacing + randomFloat(-0.75f, 0.75f) - offsetXZ;
 
-        if (shouldUseSphere(gen))
+        if (randomBool())
         {
-          objects.push_back(sphere({ x, y, z }, glm::vec3(sphereSize(gen))));
+          objects.push_back(sphere({ x, y, z }, glm::vec3(randomFloat(0.25f, 1.5f))));
 
           continue;
         }
 
-        objects.push_back(block({ x, y, z },
-          { sphereSize(gen), sphereSize(gen), sphereSize(gen) },
-          { rot(gen), rot(gen), rot(gen) }));
+        // Drawn into locals first, and braced: a call's arguments are evaluated in whichever order the
+        // compiler picks, a braced list's left to right.
+        const glm::vec3 size{ randomFloat(0.25f, 1.5f), randomFloat(0.25f, 1.5f), randomFloat(0.25f, 1.5f) };
+        const glm::vec3 rotation{ randomFloat(0.0f, 360.0f), randomFloat(0.0f, 360.0f), randomFloat(0.0f, 360.0f) };
+        objects.push_back(block({ x, y, z }, size, rotation));
       }
     }
   }
@@ -393,10 +400,6 @@ json buildFallingBalls()
     rigidBlock({ 0, -15, 0 }, { 100, 3, 100 })
   });
 
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
-
   for (int i = 0; i < gridHeight; i++)
   {
     for (int j = 0; j < gridSize; j++)
@@ -404,9 +407,9 @@ json buildFallingBalls()
       for (int k = 0; k < gridSize; k++)
       {
         objects.push_back(sphere({
-          static_cast<float>(j) * ballSpacing + dist(gen) - (gridSize * ballSpacing / 2.0f),
+          static_cast<float>(j) * ballSpacing + randomFloat(-0.5f, 0.5f) - (gridSize * ballSpacing / 2.0f),
           static_cast<float>(i) * ballSpacing,
-          static_cast<float>(k) * ballSpacing + dist(gen)
+          static_cast<float>(k) * ballSpacing + randomFloat(-0.5f, 0.5f)
         }));
       }
     }
@@ -426,10 +429,19 @@ json scene(const std::string& name, const std::string& uuid, json objects)
 
 }
 
-json buildDefaultProject()
+json buildDefaultProject(const std::optional<uint32_t> seed)
 {
-  // Scene 1 is active out of the box; the rest are switchable from the editor's asset browser.
+  if (seed.has_value())
+  {
+    randomEngine().seed(seed.value());
+  }
+
+  // Scene 1 is active out of the box; the rest are switchable from the editor's asset browser. All drawn
+  // up front: scene() below would take its uuid and its objects in whichever order the compiler picks.
   const std::string scene1UUID = newUUID();
+  const std::string scene2UUID = newUUID();
+  const std::string scene3UUID = newUUID();
+  const std::string fallingBallsUUID = newUUID();
 
   return {
     { "assets", {
@@ -460,9 +472,9 @@ json buildDefaultProject()
       })},
       { "scenes", json::array({
         scene("Scene 1", scene1UUID, buildScene1()),
-        scene("Scene 2", newUUID(), buildScene2()),
-        scene("Scene 3", newUUID(), buildScene3()),
-        scene("Falling Balls", newUUID(), buildFallingBalls())
+        scene("Scene 2", scene2UUID, buildScene2()),
+        scene("Scene 3", scene3UUID, buildScene3()),
+        scene("Falling Balls", fallingBallsUUID, buildFallingBalls())
       })}
     }},
     { "currentSceneUUID", scene1UUID }
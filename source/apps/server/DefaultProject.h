@@ -2,10 +2,13 @@
 #define DEFAULTPROJECT_H
 
 #include <nlohmann/json_fwd.hpp>
+#include <cstdint>
+#include <optional>
 
 // Builds the built-in sample project as a project blob (the same JSON shape ProjectSerializer loads,
 // so it can just be deserialize()'d). Scene 3 and the falling-balls scene are generated procedurally
-// (random placement), which a static file can't capture.
-[[nodiscard]] nlohmann::json buildDefaultProject();
+// (random placement), which a static file can't capture. A seed makes the uuids and placements
+// reproducible (deterministic runs); without one they differ every launch.
+[[nodiscard]] nlohmann::json buildDefaultProject(std::optional<uint32_t> seed = std::nullopt);
 
 #endif //DEFAULTPROJECT_H
@@ -5,14 +5,21 @@
 #include <ProjectSerializer.h>
 #include <ProjectPacker.h>
 #include <Replication.h>
+#include <StateHistory.h>
+#include <InterestGrid.h>
+#include <TransformQuantizer.h>
 #include <assets/AssetRegistry.h>
 #include <scenes/SceneManager.h>
 #include <scenes/SceneAsset.h>
 #include <objects/ObjectManager.h>
 #include <objects/Object.h>
 #include <objects/components/Component.h>
+#include <objects/components/PlayerController.h>
+#include <objects/components/Transform.h>
 #include <PhysicsSystem.h>
 #include <CollisionSystem.h>
+#include <SimulationHash.h>
+#include <JobSystem.h>
 #include <queries/SceneQueries.h>
 #include <ScriptSystem.h>
 #include <bindings/InputState.h>
@@ -20,6 +27,9 @@
 #include <NetServer.h>
 #include <ManagedHost.h>
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <format>
 #include <iostream>
 #include <thread>
 
@@ -29,6 +39,8 @@ ServerApp::ServerApp(LaunchOptions options)
     m_componentRegistry(std::make_shared<ComponentRegistry>()),
     m_assetRegistry(std::make_shared<AssetRegistry>()),
     m_sceneManager(std::make_shared<SceneManager>()),
+    m_stateHistory(std::make_shared<replication::StateHistory>()),
+    m_interestGrid(std::make_shared<replication::InterestGrid>()),
     m_previousTime(std::chrono::steady_clock::now())
 {
   // Boot the CLR from the net transport's runtimeconfig (ECS3DNet is linked by every app). The
@@ -37,16 +49,28 @@ ServerApp::ServerApp(LaunchOptions options)
 
   registerDataComponents(*m_componentRegistry);
 
+  // Size the worker pool before anything can schedule onto it.
+  JobSystem::configure(m_options.workers);
+  logMessage("Info", std::format("Job system running {} worker threads.", JobSystem::getWorkerCount()));
+
   m_projectSerializer = std::make_shared<ProjectSerializer>(m_assetRegistry.get(), m_sceneManager.get(), m_componentRegistry);
   m_projectPacker = std::make_shared<ProjectPacker>(m_assetRegistry.get(), m_sceneManager.get(), m_componentRegistry);
   m_collisionSystem = std::make_shared<CollisionSystem>();
+  m_collisionSystem->setDeterministic(m_options.deterministic);
   m_scriptSystem = std::make_shared<ScriptSystem>(m_host);
   m_netServer = std::make_shared<net::NetServer>(m_host);
 
   // Scene queries live in sim, which scripting can't link; inject them into BindingContext so the World
-  // raycast/overlapSphere bindings can call them.
+  // raycast/overlapSphere (single and batched) and shape-cast bindings can call them.
   BindingContext::setRaycast(&SceneQueries::raycast);
   BindingContext::setOverlapSphere(&SceneQueries::overlapSphere);
+  BindingContext::setSphereCast(&SceneQueries::sphereCast);
+  BindingContext::setBoxCast(&SceneQueries::boxCast);
+  BindingContext::setRaycastBatch(&SceneQueries::raycastBatch);
+  BindingContext::setOverlapSphereBatch(&SceneQueries::overlapSphereBatch);
+
+  // ...and answer them from the collision pass's broadphase rather than scanning every collider.
+  SceneQueries::setCollisionSystem(m_collisionSystem.get());
 
   // The World spawnPrefab binding resolves a prefab uuid to its body through the registry. Injected once:
   // loadProject reassigns the registry's contents, never the object.
@@ -55,8 +79,10 @@ ServerApp::ServerApp(LaunchOptions options)
   if (m_options.project.empty())
   {
     // No project file requested: run the built-in sample (scenes 1-3 + falling balls). It's generated in
-    // code because the procedural scenes can't be a static file on disk.
-    m_projectSerializer->deserialize(buildDefaultProject());
+    // code because the procedural scenes can't be a static file on disk. A deterministic run seeds it so
+    // both sides of a comparison generate the same scenes.
+    constexpr uint32_t deterministicSeed = 0;
+    m_projectSerializer->deserialize(m_options.deterministic ? buildDefaultProject(deterministicSeed) : buildDefaultProject());
   }
   else if (!m_projectSerializer->load(m_options.project) || !m_sceneManager->getCurrentScene())
   {
@@ -64,9 +90,12 @@ ServerApp::ServerApp(LaunchOptions options)
       + "' - the server will run but simulate nothing. Check the project path and working directory.");
   }
 
+  seedScenes();
+
   m_netServer->start(m_options.port, m_options.editMode, m_options.authToken);
 
   m_sceneManager->startScene();
+  resetPhysics();
 
   if (const auto scene = m_sceneManager->getCurrentScene())
   {
@@ -98,6 +127,8 @@ ServerApp::~ServerApp()
   {
     m_host->shutdown();
   }
+
+  JobSystem::shutdown();
 }
 
 bool ServerApp::isActive() const
@@ -115,11 +146,13 @@ bool ServerApp::isActive() const
 
 void ServerApp::run()
 {
+  // Everything the socket threads queued since the last pass, taken in one go.
+  std::vector<net::MessageQueue::Entry> inbound;
+
   while (isActive())
   {
-    net::Message message;
-    int32_t senderId = 0;
-    while (m_netServer->poll(message, senderId))
+    m_netServer->drain(inbound);
+    for (const auto& [message, senderId] : inbound)
     {
       // A bad/malicious message (or a script-bridge hiccup while building a snapshot) must not take the
       // whole server down - that would look like "client connected, then nothing".
@@ -171,7 +204,7 @@ void ServerApp::run()
       // has the object (or has dropped it) by the time the delta for this tick references it.
       broadcastStructuralChanges();
 
-      broadcastStateDelta();
+      sendStateDeltas();
     }
 
     // Don't busy-spin a core between ticks.
@@ -179,7 +212,7 @@ void ServerApp::run()
   }
 }
 
-void ServerApp::fixedUpdate(const float dt) const
+void ServerApp::fixedUpdate(const float dt)
 {
   const auto scene = m_sceneManager->getCurrentScene();
   if (!scene || m_sceneManager->getSceneStatus() != SceneStatus::running)
@@ -192,12 +225,33 @@ void ServerApp::fixedUpdate(const float dt) const
   // The number crunching, in order: scripts read input (variableUpdate) then queue forces, physics
   // integrates, collisions resolve. variableUpdate runs before fixedUpdate so input-driven force is
   // applied the same tick (the server has no render frame to drive it separately).
+  //
+  // Physics and collision then run the scene's substeps times over the tick, each covering 1 / substeps
+  // of it, so fast bodies resolve against thin geometry without the scripts (and their managed-call cost)
+  // running any more often. Forces queued by the scripts are drained by the first substep.
   try
   {
+    // The built-in player movement first, so the scripts see where it put the players this tick.
+    movePlayers(objectManager, dt);
+
+    const auto scriptStart = std::chrono::steady_clock::now();
     m_scriptSystem->variableUpdate(objectManager);
     m_scriptSystem->fixedUpdate(objectManager, dt);
-    PhysicsSystem::fixedUpdate(objectManager, dt);
-    m_collisionSystem->fixedUpdate(objectManager);
+    const auto physicsStart = std::chrono::steady_clock::now();
+
+    const uint32_t substeps = scene->getPhysicsSettings().substeps;
+    const float stepFraction = 1.0f / static_cast<float>(substeps);
+    for (uint32_t step = 0; step < substeps; ++step)
+    {
+      PhysicsSystem::fixedUpdate(objectManager, dt * stepFraction, m_collisionSystem.get(), stepFraction);
+      m_collisionSystem->fixedUpdate(objectManager);
+    }
+    m_collisionSystem->commitEvents();
+    const auto physicsEnd = std::chrono::steady_clock::now();
+
+    m_scriptSeconds += std::chrono::duration<double>(physicsStart - scriptStart).count();
+    m_physicsSeconds += std::chrono::duration<double>(physicsEnd - physicsStart).count();
+    m_physicsSteps += substeps;
 
     // Contact events for this tick: hand CollisionSystem's diffed pair lists to the scripts. Done here
     // in the app (not as a library call) so sim stays independent of scripting - the collision system
@@ -208,6 +262,125 @@ void ServerApp::fixedUpdate(const float dt) const
   {
     logMessage("Error", e.what());
   }
+
+  ++m_tickCount;
+
+  // Once a second, so two deterministic servers can be diffed from their logs: the first tick whose hash
+  // differs is where they diverged.
+  if (m_options.deterministic && m_tickCount % net::tickRate == 0)
+  {
+    logMessage("Info", std::format("Tick {} state hash {:016x}.", m_tickCount, hashSimulationState(objectManager)));
+  }
+
+  if (m_options.metrics && m_tickCount % net::tickRate == 0)
+  {
+    logTickMetrics();
+    logJobMetrics();
+  }
+}
+
+void ServerApp::movePlayers(const ObjectManager& objectManager, const float dt)
+{
+  // The inputs each predicting slot takes this tick: one, plus any the queue has backed up beyond
+  // maxBacklog (a burst after a stall), so it doesn't trail the client by the burst for good. A slot with
+  // none queued stands still rather than repeating its last input - the client replays exactly the inputs
+  // the server applied, so an input applied twice would be a misprediction.
+  constexpr size_t maxBacklog = 4;
+  std::unordered_map<int32_t, std::vector<uint8_t>> steps;
+
+  for (auto& [slot, inputs] : m_moveInputs)
+  {
+    auto& slotSteps = steps[slot];
+
+    while (!inputs.pending.empty() && (slotSteps.empty() || inputs.pending.size() > maxBacklog))
+    {
+      const auto [sequence, moveButtons] = inputs.pending.front();
+      inputs.pending.pop_front();
+      inputs.applied = sequence;
+      slotSteps.push_back(moveButtons);
+    }
+  }
+
+  for (const auto& object : objectManager.getAllObjects())
+  {
+    const auto playerController = object->getComponent<PlayerController>(ComponentType::playerController);
+    if (!playerController || playerController->getMoveSpeed() == 0.0f)
+    {
+      continue;
+    }
+
+    const auto transform = object->getComponent<Transform>(ComponentType::transform);
+    if (!transform || transform->getOwner() != object.get())
+    {
+      continue;
+    }
+
+    const int32_t slot = playerController->getPlayerSlot();
+    if (const auto slotSteps = steps.find(slot); slotSteps != steps.end())
+    {
+      for (const auto moveButtons : slotSteps->second)
+      {
+        playerController->move(*transform, moveButtons, dt);
+      }
+
+      continue;
+    }
+
+    const uint8_t moveButtons = PlayerController::getMoveButtons([slot](const int key) {
+      return InputState::isKeyPressed(slot, key);
+    });
+
+    playerController->move(*transform, moveButtons, dt);
+  }
+}
+
+void ServerApp::logTickMetrics()
+{
+  // Averaged over the ticks since the last log. Physics covers every substep (integration and collision),
+  // so raising a scene's substeps shows up here, not in the script time.
+  constexpr double ticks = net::tickRate;
+  logMessage("Info", std::format("Tick: {:.2f} ms scripts, {:.2f} ms physics over {:.1f} steps.",
+    m_scriptSeconds * 1000.0 / ticks, m_physicsSeconds * 1000.0 / ticks, static_cast<double>(m_physicsSteps) / ticks));
+
+  m_scriptSeconds = 0.0;
+  m_physicsSeconds = 0.0;
+  m_physicsSteps = 0;
+}
+
+void ServerApp::logJobMetrics()
+{
+  // busy / wall per job is the speedup its loop actually got: ~1 means it ran effectively serially (too
+  // little work per call, or one chunk), ~workers + 1 means it used the whole pool.
+  for (const auto& stats : JobSystem::takeStats())
+  {
+    const double speedup = stats.wallSeconds > 0.0 ? stats.busySeconds / stats.wallSeconds : 0.0;
+    logMessage("Info", std::format("Job '{}': {} runs, {} chunks, {:.2f} ms wall, {:.2f} ms busy, {:.2f}x speedup.",
+      stats.name, stats.runs, stats.chunks, stats.wallSeconds * 1000.0, stats.busySeconds * 1000.0, speedup));
+  }
+}
+
+void ServerApp::seedScenes() const
+{
+  if (!m_options.deterministic)
+  {
+    return;
+  }
+
+  // Seeded per scene (from its own uuid) so two scenes don't mint the same sequence.
+  for (const auto& [uuid, scene] : m_sceneManager->getScenes())
+  {
+    scene->getObjectManager()->seedUUIDs(static_cast<uint32_t>(hashUUID(uuid)));
+  }
+}
+
+void ServerApp::resetPhysics() const
+{
+  m_collisionSystem->reset();
+
+  if (const auto scene = m_sceneManager->getCurrentScene())
+  {
+    m_collisionSystem->setLayerMatrix(scene->getPhysicsSettings().layerMatrix);
+  }
 }
 
 void ServerApp::dispatchCollisionEvents(ObjectManager& objectManager) const
@@ -264,7 +437,7 @@ void ServerApp::handleClientMessage(const net::Message& message, const int32_t s
   switch (message.getType())
   {
     case net::MessageType::join:
-      handleJoin(message, senderId);
+      handleJoin(senderId);
       break;
 
     case net::MessageType::editComponent:
@@ -295,6 +468,14 @@ void ServerApp::handleClientMessage(const net::Message& message, const int32_t s
       handleInputState(message, senderId);
       break;
 
+    case net::MessageType::stateAck:
+      handleStateAck(message, senderId);
+      break;
+
+    case net::MessageType::moveInput:
+      handleMoveInput(message, senderId);
+      break;
+
     case net::MessageType::sceneControl:
       handleSceneControl(message);
       break;
@@ -303,29 +484,23 @@ void ServerApp::handleClientMessage(const net::Message& message, const int32_t s
   }
 }
 
-void ServerApp::handleJoin(const net::Message& message, const int32_t senderId)
+void ServerApp::handleJoin(const int32_t senderId)
 {
-  // A client joined: bind it to a player slot (so its input routes to that player), tell it whether this
-  // server is editable, then send the full project/scene as a Snapshot. Record that a connection has been
-  // seen so an ephemeral server (exitWhenEmpty) can later exit when the last one drops.
+  // A client joined: bind it to a player slot (so its input routes to that player) and tell it which, tell
+  // it whether this server is editable, then send it the full project/scene as a Snapshot. All of it goes
+  // to the joining connection alone - the views already connected have the scene and keep their delta
+  // baselines. Record that a connection has been seen so an ephemeral server (exitWhenEmpty) can later
+  // exit when the last one drops.
   m_hasConnected = true;
   const int32_t slot = assignPlayerSlot(senderId);
 
-  // If the client tagged its join with a nonce (players do; the editor sends none), tell it which slot it
-  // got so it can render through that player's camera. Broadcasting with nonce correlation avoids a
-  // per-connection send path - every client hears it, only the matching one keeps it.
-  net::MessageReader reader(message);
-  if (reader.remaining() >= sizeof(uint64_t))
-  {
-    const auto nonce = reader.read<uint64_t>();
-    net::Message reply(net::MessageType::playerSlot);
-    reply.write(nonce);
-    reply.write(slot);
-    m_netServer->broadcast(reply);
-  }
+  // Players render through their slot's camera; the editor ignores it.
+  net::Message reply(net::MessageType::playerSlot);
+  reply.write(slot);
+  m_netServer->send(senderId, reply);
 
-  broadcastEditStatus();
-  broadcastSnapshot();
+  sendEditStatus(senderId);
+  sendSnapshot(senderId);
 }
 
 int32_t ServerApp::assignPlayerSlot(const int32_t connId)
@@ -359,6 +534,8 @@ int32_t ServerApp::assignPlayerSlot(const int32_t connId)
 
 void ServerApp::handleDisconnect(const int32_t connId)
 {
+  m_clients.erase(connId);
+
   const auto it = m_connectionSlots.find(connId);
   if (it == m_connectionSlots.end())
   {
@@ -368,6 +545,7 @@ void ServerApp::handleDisconnect(const int32_t connId)
   const int32_t slot = it->second;
   m_connectionSlots.erase(it);
   InputState::removeSlot(slot);
+  m_moveInputs.erase(slot);
 
   logMessage("Info", "Connection " + std::to_string(connId) + " dropped; freed player slot "
     + std::to_string(slot) + ".");
@@ -386,24 +564,24 @@ void ServerApp::handleEditComponent(const net::Message& message) const
     // If the edit targets a Script, push the new field values into the live C# instance so the
     // running behavior reflects the change immediately (applyComponentEdit only updates the data
     // layer; the C# instance is owned by ScriptSystem and needs an explicit write). The packed layout
-    // mirrors Script::pack: [object uuid][type][className][fields].
+    // mirrors Script::pack: [object network id][type][className][fields].
     net::MessageReader reader(message);
-    const auto objectUUID = uuids::uuid::from_string(reader.readString());
+    const auto object = scene->getObjectManager()->getObjectByNetworkID(reader.read<uint32_t>());
 
-    if (objectUUID.has_value() && reader.read<ComponentType>() == ComponentType::script)
+    if (object && reader.read<ComponentType>() == ComponentType::script)
     {
       const auto className = reader.readString();
       const auto fields = nlohmann::json::parse(reader.readString(), nullptr, false);
 
       if (!fields.is_discarded())
       {
-        m_scriptSystem->applyScriptFieldEdit(objectUUID.value(), className, fields);
+        m_scriptSystem->applyScriptFieldEdit(object->getUUID(), className, fields);
       }
     }
   }
 }
 
-void ServerApp::handleSceneEdit(const net::Message& message) const
+void ServerApp::handleSceneEdit(const net::Message& message)
 {
   // An editor changed the scene graph (add/remove object or component, or instantiate a prefab): apply
   // it, then re-snapshot so every view rebuilds (structural changes aren't replicated per-op). The
@@ -422,7 +600,7 @@ void ServerApp::handleSceneEdit(const net::Message& message) const
   }
 }
 
-void ServerApp::handleLoadProject(const net::Message& message) const
+void ServerApp::handleLoadProject(const net::Message& message)
 {
   // An editor opened a different project: stop the current scripts, swap the project in, restart,
   // and snapshot so every view rebuilds. The blob is sent (not a path) so it works off-machine too.
@@ -453,10 +631,12 @@ void ServerApp::handleLoadProject(const net::Message& message) const
     return;
   }
 
+  seedScenes();
+
   m_sceneManager->startScene();
 
   // New project/scene: any contact history belongs to the project we just swapped out.
-  m_collisionSystem->reset();
+  resetPhysics();
 
   if (const auto scene = m_sceneManager->getCurrentScene())
   {
@@ -476,7 +656,7 @@ void ServerApp::handleLoadProject(const net::Message& message) const
   broadcastSnapshot();
 }
 
-void ServerApp::handleAddAsset(const net::Message& message) const
+void ServerApp::handleAddAsset(const net::Message& message)
 {
   // An editor imported/created an asset: register it in the authoritative registry and re-snapshot.
   nlohmann::json asset;
@@ -496,7 +676,7 @@ void ServerApp::handleAddAsset(const net::Message& message) const
   broadcastSnapshot();
 }
 
-void ServerApp::handleRenameAsset(const net::Message& message) const
+void ServerApp::handleRenameAsset(const net::Message& message)
 {
   // An editor renamed an asset (display-name override only): apply it authoritatively and re-snapshot.
   nlohmann::json op;
@@ -516,7 +696,7 @@ void ServerApp::handleRenameAsset(const net::Message& message) const
   broadcastSnapshot();
 }
 
-void ServerApp::handleRemoveAsset(const net::Message& message) const
+void ServerApp::handleRemoveAsset(const net::Message& message)
 {
   // An editor deleted an asset: drop the record and re-snapshot. References dangle by design (lookups
   // null-tolerate a missing uuid).
@@ -572,7 +752,44 @@ void ServerApp::handleInputState(const net::Message& message, const int32_t send
   }
 }
 
-void ServerApp::handleSceneControl(const net::Message& message) const
+void ServerApp::handleMoveInput(const net::Message& message, const int32_t senderId)
+{
+  const int32_t slot = assignPlayerSlot(senderId);
+  const auto [sequence, moveButtons] = replication::readMoveInput(message);
+
+  auto& inputs = m_moveInputs[slot];
+  if (sequence <= inputs.received)
+  {
+    return;
+  }
+
+  inputs.received = sequence;
+  inputs.pending.emplace_back(sequence, moveButtons);
+
+  // A second's worth queued means the scene isn't running them (paused, stopped); the oldest are stale.
+  while (inputs.pending.size() > static_cast<size_t>(net::tickRate))
+  {
+    inputs.pending.pop_front();
+  }
+}
+
+void ServerApp::handleStateAck(const net::Message& message, const int32_t senderId)
+{
+  const auto view = m_clients.find(senderId);
+  if (view == m_clients.end())
+  {
+    return;
+  }
+
+  // Only a tick the history still holds is any use as a baseline; an ack from before a reset (a snapshot
+  // went out since) isn't, and neither is one older than what the client already acked.
+  if (const auto tick = replication::readStateAck(message); m_stateHistory->holds(tick))
+  {
+    view->second.acked = std::max(view->second.acked, tick);
+  }
+}
+
+void ServerApp::handleSceneControl(const net::Message& message)
 {
   net::MessageReader reader(message);
 
@@ -621,7 +838,7 @@ void ServerApp::handleSceneControl(const net::Message& message) const
 
         // Fresh run: drop any contact history from the previous run so its first tick doesn't fire
         // spurious enter/exit events against stale pairs.
-        m_collisionSystem->reset();
+        resetPhysics();
       }
     }
     else if (op == net::SceneControlOp::pause)
@@ -634,7 +851,7 @@ void ServerApp::handleSceneControl(const net::Message& message) const
       {
         m_scriptSystem->stop(objectManager);
         m_sceneManager->resetScene();
-        m_collisionSystem->reset();
+        resetPhysics();
       }
     }
   }
@@ -648,7 +865,7 @@ void ServerApp::handleSceneControl(const net::Message& message) const
   broadcastSnapshot();
 }
 
-void ServerApp::loadScene(const std::string& sceneUUID) const
+void ServerApp::loadScene(const std::string& sceneUUID)
 {
   const auto parsed = uuids::uuid::from_string(sceneUUID);
   if (!parsed.has_value())
@@ -679,7 +896,7 @@ void ServerApp::loadScene(const std::string& sceneUUID) const
   m_sceneManager->startScene();
 
   // New scene: contact history from the previous scene is meaningless here.
-  m_collisionSystem->reset();
+  resetPhysics();
 
   try
   {
@@ -696,7 +913,7 @@ void ServerApp::loadScene(const std::string& sceneUUID) const
   broadcastSnapshot();
 }
 
-void ServerApp::broadcastSnapshot() const
+void ServerApp::syncScriptFields() const
 {
   // Refresh each Script's field blob from its live C# instance so the snapshot carries current values.
   // This reaches into the script bridge, so guard it: a field-sync hiccup must NOT stop the snapshot
@@ -713,39 +930,103 @@ void ServerApp::broadcastSnapshot() const
       logMessage("Error", std::string("syncFieldsToData failed, sending snapshot with last-known field values: ") + e.what());
     }
   }
+}
 
+net::Message ServerApp::packSnapshot(const std::unordered_set<uint32_t>* roots) const
+{
   // Binary snapshot: ProjectPacker writes the same project state ProjectSerializer::serialize would,
   // but tightly packed instead of JSON. ProjectSerializer stays the JSON path for file save/load.
   net::Message message(net::MessageType::snapshot);
-  m_projectPacker->pack(message);
+  m_projectPacker->pack(message, roots);
 
   const auto currentScene = m_sceneManager->getCurrentScene();
-  logMessage("Info", "Broadcasting snapshot: " + std::to_string(m_sceneManager->getScenes().size())
+  logMessage("Info", "Packed snapshot: " + std::to_string(m_sceneManager->getScenes().size())
     + " scene(s), " + std::to_string(message.size()) + " bytes, currentScene='"
     + (currentScene ? uuids::to_string(currentScene->getUUID()) : std::string{}) + "'.");
 
-  m_netServer->broadcast(message);
+  return message;
+}
+
+void ServerApp::broadcastSnapshot()
+{
+  syncScriptFields();
+
+  // Every view now holds exactly what the snapshot carried, whatever the deltas left out since (a reset
+  // scale, say), and drops its history, so start the delta stream over from it: no ack from before this
+  // point is held any more, and the next delta resends everything in full.
+  m_stateHistory->reset();
+
+  for (auto& [connId, view] : m_clients)
+  {
+    resetView(view);
+  }
+
+  // With interest on, each view's snapshot carries only the roots in range of it, and updateInterest
+  // streams in the rest as they come into range.
+  const auto scene = m_sceneManager->getCurrentScene();
+  if (m_options.interestRadius <= 0.0f || !scene)
+  {
+    m_netServer->broadcast(packSnapshot());
+  }
+  else
+  {
+    buildInterest(*scene->getObjectManager());
+
+    for (auto& [connId, view] : m_clients)
+    {
+      seedInterest(connId, view, *scene->getObjectManager());
+      m_netServer->send(connId, packSnapshot(&view.roots));
+    }
+  }
 
   broadcastSceneStatus();
 }
 
-void ServerApp::broadcastSceneStatus() const
+void ServerApp::sendSnapshot(const int32_t connId)
+{
+  syncScriptFields();
+
+  // Only this view dropped its history: its deltas start over with a full one, everyone else's carry on.
+  auto& view = m_clients[connId];
+  resetView(view);
+
+  const auto scene = m_sceneManager->getCurrentScene();
+  if (m_options.interestRadius <= 0.0f || !scene)
+  {
+    m_netServer->send(connId, packSnapshot());
+  }
+  else
+  {
+    buildInterest(*scene->getObjectManager());
+    seedInterest(connId, view, *scene->getObjectManager());
+    m_netServer->send(connId, packSnapshot(&view.roots));
+  }
+
+  m_netServer->send(connId, buildSceneStatus());
+}
+
+net::Message ServerApp::buildSceneStatus() const
 {
   net::Message message(net::MessageType::sceneStatus);
   message.write(m_sceneManager->getSceneStatus());
 
-  m_netServer->broadcast(message);
+  return message;
+}
+
+void ServerApp::broadcastSceneStatus() const
+{
+  m_netServer->broadcast(buildSceneStatus());
 }
 
-void ServerApp::broadcastEditStatus() const
+void ServerApp::sendEditStatus(const int32_t connId) const
 {
   net::Message message(net::MessageType::editStatus);
   message.write(m_options.editMode);
 
-  m_netServer->broadcast(message);
+  m_netServer->send(connId, message);
 }
 
-void ServerApp::broadcastStateDelta() const
+void ServerApp::sendStateDeltas()
 {
   const auto scene = m_sceneManager->getCurrentScene();
   if (!scene)
@@ -753,37 +1034,258 @@ void ServerApp::broadcastStateDelta() const
     return;
   }
 
-  // Binary state delta: packStateDelta writes each object's uuid + local transform straight into the
-  // message, rather than a heavier per-tick JSON dump.
-  net::Message message(net::MessageType::stateDelta);
-  replication::packStateDelta(message, *scene->getObjectManager());
-  m_netServer->broadcast(message);
+  const TransformQuantizer quantizer(scene->getPhysicsSettings());
+  m_stateHistory->record(*scene->getObjectManager(), quantizer, replication::refreshTicks);
+
+  // Before the deltas, so a client has an object that came into range by the time its delta names it.
+  updateInterest(*scene->getObjectManager());
+
+  // Clients that acked the same tick (typically all of them, on a quiet link) get the same bytes, so
+  // each distinct baseline is packed once - unless interest is on, which gives every view its own set.
+  // An ack the history has dropped falls back to a full delta.
+  const bool filtered = m_options.interestRadius > 0.0f;
+  const auto simulationTick = static_cast<uint32_t>(m_tickCount);
+  std::unordered_map<uint64_t, net::Message> deltas;
+  for (const auto& [connId, view] : m_clients)
+  {
+    const uint32_t baseline = m_stateHistory->holds(view.acked) ? view.acked : 0;
+
+    // A predicting client's delta also echoes the last of its move inputs applied, so only the clients that
+    // aren't predicting (0) share.
+    uint32_t moveSequence = 0;
+    if (const auto slot = m_connectionSlots.find(connId); slot != m_connectionSlots.end())
+    {
+      if (const auto inputs = m_moveInputs.find(slot->second); inputs != m_moveInputs.end())
+      {
+        moveSequence = inputs->second.applied;
+      }
+    }
+
+    if (filtered)
+    {
+      net::Message delta(net::MessageType::stateDelta);
+      replication::packStateDelta(delta, *m_stateHistory, simulationTick, baseline, moveSequence, quantizer,
+                                  &view.interest);
+      m_netServer->send(connId, delta);
+      continue;
+    }
+
+    const uint64_t key = static_cast<uint64_t>(moveSequence) << 32 | baseline;
+    auto [delta, packed] = deltas.try_emplace(key, net::MessageType::stateDelta);
+    if (packed)
+    {
+      replication::packStateDelta(delta->second, *m_stateHistory, simulationTick, baseline, moveSequence, quantizer);
+    }
+
+    m_netServer->send(connId, delta->second);
+  }
+}
+
+void ServerApp::resetView(ClientView& view)
+{
+  view.acked = 0;
+  view.interest.clear();
+  view.roots.clear();
+}
+
+void ServerApp::buildInterest(const ObjectManager& objectManager)
+{
+  m_interestGrid->build(objectManager, m_options.interestRadius);
+
+  // Each slot's player object position, found in one pass over the scene rather than one per client.
+  m_interestFocus.clear();
+  for (const auto& object : objectManager.getAllObjects())
+  {
+    const auto playerController = object->getComponent<PlayerController>(ComponentType::playerController);
+    const auto transform = object->getComponent<Transform>(ComponentType::transform);
+
+    if (playerController && transform)
+    {
+      const auto position = transform->getPosition();
+      if (std::isfinite(position.x) && std::isfinite(position.y) && std::isfinite(position.z))
+      {
+        m_interestFocus.try_emplace(playerController->getPlayerSlot(), position);
+      }
+    }
+  }
 }
 
-void ServerApp::broadcastStructuralChanges() const
+void ServerApp::queryInterest(const ObjectManager& objectManager, const int32_t connId,
+                              std::vector<std::shared_ptr<Object>>& inRange) const
+{
+  inRange.clear();
+
+  const auto slot = m_connectionSlots.find(connId);
+  const auto position = slot != m_connectionSlots.end() ? m_interestFocus.find(slot->second) : m_interestFocus.end();
+  if (position != m_interestFocus.end())
+  {
+    m_interestGrid->query(position->second, m_options.interestRadius, inRange);
+  }
+  else
+  {
+    inRange = objectManager.getObjects();
+  }
+}
+
+void ServerApp::seedInterest(const int32_t connId, ClientView& view, const ObjectManager& objectManager) const
+{
+  std::vector<std::shared_ptr<Object>> inRange;
+  queryInterest(objectManager, connId, inRange);
+
+  // Had since tick 0: the next delta is a full one anyway, and after that they're on the baseline.
+  std::vector<std::shared_ptr<Object>> pending;
+  for (const auto& object : inRange)
+  {
+    view.roots.insert(object->getNetworkID());
+
+    pending.assign(1, object);
+    while (!pending.empty())
+    {
+      const auto node = pending.back();
+      pending.pop_back();
+
+      view.interest.emplace(node->getNetworkID(), 0);
+      pending.insert(pending.end(), node->getChildren().begin(), node->getChildren().end());
+    }
+  }
+}
+
+void ServerApp::updateInterest(const ObjectManager& objectManager)
+{
+  if (m_options.interestRadius <= 0.0f)
+  {
+    return;
+  }
+
+  buildInterest(objectManager);
+
+  const uint32_t tick = m_stateHistory->getTick();
+
+  std::vector<std::shared_ptr<Object>> inRange;
+  std::unordered_set<uint32_t> wanted;
+  std::vector<std::shared_ptr<Object>> pending;
+
+  for (auto& [connId, view] : m_clients)
+  {
+    // Objects destroyed since: a runtime destroy already told this view (broadcastStructuralChanges).
+    std::erase_if(view.interest, [&objectManager](const auto& entry) {
+      return objectManager.getObjectByNetworkID(entry.first) == nullptr;
+    });
+    std::erase_if(view.roots, [&objectManager](const uint32_t networkID) {
+      return objectManager.getObjectByNetworkID(networkID) == nullptr;
+    });
+
+    queryInterest(objectManager, connId, inRange);
+
+    wanted.clear();
+    for (const auto& object : inRange)
+    {
+      const auto networkID = object->getNetworkID();
+      wanted.insert(networkID);
+
+      if (!view.roots.insert(networkID).second)
+      {
+        continue;
+      }
+
+      // Came into range: the whole subtree comes with it, and its next delta entries go out in full.
+      m_netServer->send(connId, replication::buildObjectSpawned(*object));
+
+      pending.assign(1, object);
+      while (!pending.empty())
+      {
+        const auto node = pending.back();
+        pending.pop_back();
+
+        view.interest.insert_or_assign(node->getNetworkID(), tick);
+        pending.insert(pending.end(), node->getChildren().begin(), node->getChildren().end());
+      }
+    }
+
+    for (auto root = view.roots.begin(); root != view.roots.end();)
+    {
+      if (wanted.contains(*root))
+      {
+        ++root;
+        continue;
+      }
+
+      // Out of range: culled on the client's end, and no longer named by its deltas.
+      m_netServer->send(connId, replication::buildObjectDestroyed(*root));
+
+      pending.assign(1, objectManager.getObjectByNetworkID(*root));
+      while (!pending.empty())
+      {
+        const auto node = pending.back();
+        pending.pop_back();
+
+        view.interest.erase(node->getNetworkID());
+        pending.insert(pending.end(), node->getChildren().begin(), node->getChildren().end());
+      }
+
+      root = view.roots.erase(root);
+    }
+  }
+}
+
+void ServerApp::broadcastStructuralChanges()
 {
   // The spawn/destroy bindings buffered what the scripts did on BindingContext (scripting can't reach the
   // net layer). Broadcast spawns before destroys, then remove the marked objects from the authoritative
   // scene. A spawned object is still live here, so its packed blob carries current transform/components.
+  //
+  // With interest on, a spawn reaches each view through updateInterest once it's in range, and a destroy
+  // only the views that have the object.
+  const bool filtered = m_options.interestRadius > 0.0f;
+
   const auto spawned = BindingContext::takeSpawned();
-  for (const auto& object : spawned)
+  if (!filtered)
   {
-    m_netServer->broadcast(replication::buildObjectSpawned(*object));
+    for (const auto& object : spawned)
+    {
+      m_netServer->broadcast(replication::buildObjectSpawned(*object));
+    }
   }
 
   const auto destroyed = BindingContext::takeDestroyed();
-  for (const auto& uuid : destroyed)
+  if (destroyed.empty())
   {
-    m_netServer->broadcast(replication::buildObjectDestroyed(uuid));
+    return;
   }
 
-  if (!destroyed.empty())
+  const auto scene = m_sceneManager->getCurrentScene();
+  if (!scene)
   {
-    if (const auto scene = m_sceneManager->getCurrentScene())
+    return;
+  }
+
+  // The marked objects are still in the scene until the delete below, so each can be named by its network id.
+  const auto& objectManager = scene->getObjectManager();
+  for (const auto& uuid : destroyed)
+  {
+    const auto object = objectManager->getObjectByUUID(uuid);
+    if (!object)
+    {
+      continue;
+    }
+
+    if (!filtered)
     {
-      scene->getObjectManager()->deleteObjectsMarkedForDeletion();
+      m_netServer->broadcast(replication::buildObjectDestroyed(object->getNetworkID()));
+      continue;
+    }
+
+    for (auto& [connId, view] : m_clients)
+    {
+      if (view.interest.contains(object->getNetworkID()))
+      {
+        view.roots.erase(object->getNetworkID());
+        m_netServer->send(connId, replication::buildObjectDestroyed(object->getNetworkID()));
+      }
     }
   }
+
+  objectManager->deleteObjectsMarkedForDeletion();
 }
 
 void ServerApp::logMessage(const std::string& level, const std::string& message)
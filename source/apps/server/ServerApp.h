@@ -3,11 +3,15 @@
 
 #include <Protocol.h>
 #include <nlohmann/json_fwd.hpp>
+#include <glm/vec3.hpp>
 #include <chrono>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 class ManagedHost;
 class ComponentRegistry;
@@ -18,12 +22,18 @@ class ProjectPacker;
 class CollisionSystem;
 class ScriptSystem;
 class ObjectManager;
+class Object;
 
 namespace net {
   class NetServer;
   class Message;
 }
 
+namespace replication {
+  class StateHistory;
+  class InterestGrid;
+}
+
 // The authoritative server. It owns the simulation and is the only thing that links ECS3DSim + ECS3DScripting.
 class ServerApp final {
 public:
@@ -35,6 +45,20 @@ public:
     // instead of running until killed like a dedicated server.
     bool exitWhenEmpty = false;
     std::string authToken;
+    // Lockstep/replay mode: a serial, stably-ordered collision pass and seeded uuid generation (plus a
+    // seeded default project), so two servers fed the same project and inputs stay bit-identical. The
+    // state hash is logged every second to compare runs.
+    bool deterministic = false;
+    // Worker threads for the job system that runs physics, collision and batched queries (0 = one per
+    // hardware thread, less the tick thread).
+    uint32_t workers = 0;
+    // Log the tick's script/physics split and each job's timing and achieved parallel speedup once a second.
+    bool metrics = false;
+    // Area of interest: a player is only sent the root objects within this distance of its player object
+    // (the one whose PlayerController holds its slot); the rest are destroyed on its end and spawned again
+    // when they come back in range. 0 sends everything to everyone. A connection without a player object
+    // (an editor) always gets everything.
+    float interestRadius = 0.0f;
   };
 
   explicit ServerApp(LaunchOptions options);
@@ -62,10 +86,27 @@ private:
   std::shared_ptr<CollisionSystem> m_collisionSystem;
   std::shared_ptr<ScriptSystem> m_scriptSystem;
 
+  // The quantized transforms of the last StateHistory::ringTicks deltas, which each client's delta is
+  // encoded against.
+  std::shared_ptr<replication::StateHistory> m_stateHistory;
+
+  // --interest-radius: the root objects by position, and each player slot's player object position,
+  // rebuilt each tick (and for each snapshot) for the per-player range queries.
+  std::shared_ptr<replication::InterestGrid> m_interestGrid;
+  std::unordered_map<int32_t, glm::vec3> m_interestFocus;
+
   std::chrono::steady_clock::time_point m_previousTime;
-  const float m_fixedUpdateDt = 1.0f / 50.0f;
+  const float m_fixedUpdateDt = 1.0f / net::tickRate;
   float m_timeAccumulator = 0.0f;
 
+  // Ticks simulated since launch (only counts ticks where the scene actually ran).
+  uint64_t m_tickCount = 0;
+
+  // --metrics: time spent in scripts vs physics substeps since the last log.
+  double m_scriptSeconds = 0.0;
+  double m_physicsSeconds = 0.0;
+  uint64_t m_physicsSteps = 0;
+
   // For an exitWhenEmpty server: set once the first client has connected, so isActive() only starts
   // applying the "no connections left" exit check after the spawning app has actually connected (and
   // doesn't exit during the launch -> connect window when the count is still 0).
@@ -77,13 +118,54 @@ private:
   // the tick thread (join / inputState / disconnect all run there), so no locking is needed.
   std::unordered_map<int32_t, int32_t> m_connectionSlots;
 
+  // What the server knows of each joined connection's view. Added on join, dropped on disconnect.
+  struct ClientView {
+    // The last delta tick it acked (0 = none yet), its next delta's baseline while the history holds it.
+    uint32_t acked = 0;
+
+    // --interest-radius only: the objects it has, by network id, each with the delta tick it got them
+    // (replication::Interest), and which of those are roots - interest comes and goes a root at a time.
+    std::unordered_map<uint32_t, uint32_t> interest;
+    std::unordered_set<uint32_t> roots;
+  };
+
+  std::unordered_map<int32_t, ClientView> m_clients;
+
+  // A predicting client's moveInputs, by player slot: the built-in movement (PlayerController::move) of
+  // that slot's objects takes one a tick, in order, and each delta to the client echoes the last taken. A
+  // slot that never sent one moves by its keys in InputState.
+  struct MoveInputs {
+    std::deque<std::pair<uint32_t, uint8_t>> pending;
+    uint32_t received = 0;
+    uint32_t applied = 0;
+  };
+
+  std::unordered_map<int32_t, MoveInputs> m_moveInputs;
+
   // Bind connId to the lowest free player slot (idempotent - returns the existing slot if already bound).
   int32_t assignPlayerSlot(int32_t connId);
 
   // Release a dropped connection's slot and clear its input.
   void handleDisconnect(int32_t connId);
 
-  void fixedUpdate(float dt) const;
+  void fixedUpdate(float dt);
+
+  // One tick of every PlayerController's built-in movement (those with a move speed).
+  void movePlayers(const ObjectManager& objectManager, float dt);
+
+  // --metrics: log (and reset) the per-tick script/physics split.
+  void logTickMetrics();
+
+  // --metrics: log (and reset) the job system's per-job timing.
+  static void logJobMetrics();
+
+  // Deterministic mode: restart every scene's uuid generator from a fixed seed, so runtime spawns get the
+  // same uuids on every run. Called whenever a project is (re)loaded.
+  void seedScenes() const;
+
+  // Drop the collision system's per-run state (contacts, partition, query trees) and configure it from the
+  // current scene's PhysicsSettings. Called whenever the active scene, the project or the run changes.
+  void resetPhysics() const;
 
   // Feed this tick's collision enter/stay/exit pairs (from CollisionSystem) into the scripts. Bridges
   // sim and scripting at the app level so neither library depends on the other.
@@ -93,40 +175,76 @@ private:
   // messages like inputState land in the right slot.
   void handleClientMessage(const net::Message& message, int32_t senderId);
 
-  void handleJoin(const net::Message& message, int32_t senderId);
+  void handleJoin(int32_t senderId);
 
   void handleEditComponent(const net::Message& message) const;
 
-  void handleSceneEdit(const net::Message& message) const;
+  void handleSceneEdit(const net::Message& message);
 
-  void handleLoadProject(const net::Message& message) const;
+  void handleLoadProject(const net::Message& message);
 
-  void handleAddAsset(const net::Message& message) const;
+  void handleAddAsset(const net::Message& message);
 
-  void handleRenameAsset(const net::Message& message) const;
+  void handleRenameAsset(const net::Message& message);
 
-  void handleRemoveAsset(const net::Message& message) const;
+  void handleRemoveAsset(const net::Message& message);
 
   void handleInputState(const net::Message& message, int32_t senderId);
 
-  void handleSceneControl(const net::Message& message) const;
+  void handleStateAck(const net::Message& message, int32_t senderId);
+
+  void handleMoveInput(const net::Message& message, int32_t senderId);
+
+  void handleSceneControl(const net::Message& message);
+
+  void loadScene(const std::string& sceneUUID);
+
+  // Refresh every Script's field blob from its live instance, so a snapshot carries current values.
+  void syncScriptFields() const;
 
-  void loadScene(const std::string& sceneUUID) const;
+  // The whole project as a Snapshot. roots, if given, limits the current scene to those root objects.
+  [[nodiscard]] net::Message packSnapshot(const std::unordered_set<uint32_t>* roots = nullptr) const;
 
-  void broadcastSnapshot() const;
+  // After a structural change every view needs the new scene.
+  void broadcastSnapshot();
 
-  // Tells clients whether this server accepts edits (true only for an edit-mode server), so an editor
-  // can show a read-only cue and disable its editing UI instead of looking broken/blank.
-  void broadcastEditStatus() const;
+  // A joining view needs it alone; the rest already have it.
+  void sendSnapshot(int32_t connId);
+
+  // Tells a joining client whether this server accepts edits (true only for an edit-mode server), so an
+  // editor can show a read-only cue and disable its editing UI instead of looking broken/blank.
+  void sendEditStatus(int32_t connId) const;
+
+  [[nodiscard]] net::Message buildSceneStatus() const;
 
   void broadcastSceneStatus() const;
 
-  void broadcastStateDelta() const;
+  // Record this tick in the state history, bring each view's interest up to date, then send each joined
+  // client its delta against its baseline (clients sharing a baseline and interest share one message).
+  void sendStateDeltas();
+
+  // A view about to be sent a snapshot: no ack of it holds any more, and (--interest-radius) it has
+  // nothing until seedInterest picks what the snapshot carries.
+  void resetView(ClientView& view);
+
+  // --interest-radius: index objectManager's roots and player positions for queryInterest.
+  void buildInterest(const ObjectManager& objectManager);
+
+  // --interest-radius: the roots in range of connId's player object, or all of them if it has none.
+  void queryInterest(const ObjectManager& objectManager, int32_t connId,
+                     std::vector<std::shared_ptr<Object>>& inRange) const;
+
+  // --interest-radius: a reset view gets the roots in range, and their subtrees, from its snapshot.
+  void seedInterest(int32_t connId, ClientView& view, const ObjectManager& objectManager) const;
+
+  // --interest-radius: diff each view's roots against those in range of its player object, sending the
+  // ones that came into range as objectSpawned and the ones that left as objectDestroyed, to it alone.
+  void updateInterest(const ObjectManager& objectManager);
 
   // Drain the spawn/destroy a script requested this tick (buffered on BindingContext): broadcast an
   // objectSpawned/objectDestroyed per change, then actually delete the marked objects. Runs after the
   // tick's scripts, before the state delta.
-  void broadcastStructuralChanges() const;
+  void broadcastStructuralChanges();
 };
 
 
@@ -36,6 +36,25 @@ int main(const int argc, char** argv)
       {
         options.authToken = argv[++i];
       }
+      else if (arg == "--deterministic")
+      {
+        // Lockstep/replay: bit-identical simulation for the same project and inputs (see LaunchOptions).
+        options.deterministic = true;
+      }
+      else if (arg == "--workers" && i + 1 < argc)
+      {
+        // Job system worker threads (0/absent = one per hardware thread, less the tick thread).
+        options.workers = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--metrics")
+      {
+        options.metrics = true;
+      }
+      else if (arg == "--interest-radius" && i + 1 < argc)
+      {
+        // Only send each player the objects within this distance of its player object (0 = everything).
+        options.interestRadius = std::stof(argv[++i]);
+      }
     }
 
     ServerApp app(options);
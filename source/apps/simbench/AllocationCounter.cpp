@@ -0,0 +1,128 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> s_allocations{ 0 };
+std::atomic<uint64_t> s_bytes{ 0 };
+
+void count(const std::size_t size)
+{
+  s_allocations.fetch_add(1, std::memory_order_relaxed);
+  s_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void* allocate(const std::size_t size)
+{
+  count(size);
+
+  // malloc(0) may return null; new must not.
+  if (void* pointer = std::malloc(size == 0 ? 1 : size))
+  {
+    return pointer;
+  }
+
+  throw std::bad_alloc();
+}
+
+void* allocateAligned(const std::size_t size, const std::align_val_t alignment)
+{
+  count(size);
+
+  const auto align = static_cast<std::size_t>(alignment);
+
+#ifdef _WIN32
+  void* pointer = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+  // aligned_alloc wants the size to be a multiple of the alignment.
+  void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+
+  if (!pointer)
+  {
+    throw std::bad_alloc();
+  }
+
+  return pointer;
+}
+
+void freeAligned(void* pointer)
+{
+#ifdef _WIN32
+  _aligned_free(pointer);
+#else
+  std::free(pointer);
+#endif
+}
+
+}
+
+AllocationCounts getAllocationCounts()
+{
+  return { s_allocations.load(std::memory_order_relaxed), s_bytes.load(std::memory_order_relaxed) };
+}
+
+// The replaceable forms. The library's nothrow variants forward to these; the aligned family is separate
+// because Windows frees it with its own call.
+
+void* operator new(const std::size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new[](const std::size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+  return allocateAligned(size, alignment);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+  return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+  freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+  freeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+  freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+  freeAligned(pointer);
+}
@@ -0,0 +1,19 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+// Process-wide heap allocation counters. AllocationCounter.cpp replaces the global operator new/delete
+// for this executable, so every allocation - the sim's, the job system's, the standard library's - is
+// counted, from any thread. Relaxed atomics: the counts are exact, only their ordering against other
+// memory isn't.
+struct AllocationCounts {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+};
+
+[[nodiscard]] AllocationCounts getAllocationCounts();
+
+
+
+#endif //ALLOCATIONCOUNTER_H
@@ -0,0 +1,333 @@
+#include "SimBench.h"
+#include "AllocationCounter.h"
+#include "DefaultProject.h"
+#include <ComponentRegistry.h>
+#include <ComponentRegistration.h>
+#include <ProjectSerializer.h>
+#include <assets/AssetRegistry.h>
+#include <scenes/SceneAsset.h>
+#include <scenes/SceneManager.h>
+#include <objects/ObjectManager.h>
+#include <PhysicsSystem.h>
+#include <CollisionSystem.h>
+#include <SimulationHash.h>
+#include <JobSystem.h>
+#include <nlohmann/json.hpp>
+#include <glm/vec3.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <random>
+#include <ranges>
+#include <uuid.h>
+
+using nlohmann::json;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsBetween(const Clock::time_point start, const Clock::time_point end)
+{
+  return std::chrono::duration<double>(end - start).count();
+}
+
+json vec(const glm::vec3& v)
+{
+  return json::array({ v.x, v.y, v.z });
+}
+
+// Same serialized shapes as the sample project's; instantiate() gives each copy its own uuid.
+json syntheticObject(const std::string& name, const glm::vec3& position, const glm::vec3& scale, json components)
+{
+  const json transform = {
+    { "type", "Transform" },
+    { "position", vec(position) },
+    { "rotation", vec(glm::vec3(0)) },
+    { "scale", vec(scale) }
+  };
+  components.insert(components.begin(), transform);
+
+  return {
+    { "name", name },
+    { "uuid", "" },
+    { "children", json::array() },
+    { "components", std::move(components) },
+    { "scripts", json::array() }
+  };
+}
+
+json syntheticBody(const glm::vec3& position, const glm::vec3& velocity)
+{
+  return syntheticObject("Body", position, glm::vec3(1), json::array({
+    {
+      { "type", "RigidBody" },
+      { "velocity", vec(velocity) },
+      { "angularVelocity", vec(glm::vec3(0)) },
+      { "friction", 0.1 },
+      { "doGravity", true },
+      { "gravity", -9.81 },
+      { "mass", 10.0 }
+    },
+    {
+      { "type", "Collider" },
+      { "subType", "Sphere" },
+      { "radius", 1.0 },
+      { "renderCollider", false },
+      { "position", vec(glm::vec3(0)) }
+    }
+  }));
+}
+
+json syntheticGround(const float width)
+{
+  return syntheticObject("Ground", glm::vec3(0, -3, 0), glm::vec3(width, 3, width), json::array({
+    {
+      { "type", "Collider" },
+      { "subType", "Box" },
+      { "position", vec(glm::vec3(0)) },
+      { "rotation", vec(glm::vec3(0)) },
+      { "scale", vec(glm::vec3(1)) }
+    }
+  }));
+}
+
+// One tick as the server runs it, minus the scripts.
+struct TickTimes {
+  double physicsSeconds = 0.0;
+  double collisionSeconds = 0.0;
+  double eventSeconds = 0.0;
+};
+
+TickTimes tick(const SceneAsset& scene, CollisionSystem& collisionSystem, const float dt)
+{
+  auto& objectManager = *scene.getObjectManager();
+
+  const uint32_t substeps = scene.getPhysicsSettings().substeps;
+  const float stepFraction = 1.0f / static_cast<float>(substeps);
+
+  TickTimes times;
+  for (uint32_t step = 0; step < substeps; ++step)
+  {
+    const auto physicsStart = Clock::now();
+    PhysicsSystem::fixedUpdate(objectManager, dt * stepFraction, &collisionSystem, stepFraction);
+    const auto collisionStart = Clock::now();
+    collisionSystem.fixedUpdate(objectManager);
+    const auto collisionEnd = Clock::now();
+
+    times.physicsSeconds += secondsBetween(physicsStart, collisionStart);
+    times.collisionSeconds += secondsBetween(collisionStart, collisionEnd);
+  }
+
+  const auto eventStart = Clock::now();
+  collisionSystem.commitEvents();
+  times.eventSeconds = secondsBetween(eventStart, Clock::now());
+
+  return times;
+}
+
+// Nearest-rank percentile of an ascending list.
+double percentile(const std::vector<double>& sorted, const double fraction)
+{
+  if (sorted.empty())
+  {
+    return 0.0;
+  }
+
+  const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+}
+
+SimBench::SimBench(Options options)
+  : m_options(std::move(options)),
+    m_componentRegistry(std::make_shared<ComponentRegistry>())
+{
+  registerDataComponents(*m_componentRegistry);
+
+  JobSystem::configure(m_options.workers);
+}
+
+SimBench::~SimBench()
+{
+  JobSystem::shutdown();
+}
+
+json SimBench::run() const
+{
+  std::vector<std::shared_ptr<SceneAsset>> scenes;
+  if (m_options.syntheticBodies > 0)
+  {
+    scenes.push_back(buildSyntheticScene());
+  }
+  else
+  {
+    scenes = loadSampleScenes();
+  }
+
+  json sceneReports = json::array();
+  for (const auto& scene : scenes)
+  {
+    sceneReports.push_back(benchScene(*scene));
+  }
+
+  return {
+    { "workers", JobSystem::getWorkerCount() },
+    { "deterministic", m_options.deterministic },
+    { "seed", m_options.seed },
+    { "warmupTicks", m_options.warmupTicks },
+    { "scenes", std::move(sceneReports) }
+  };
+}
+
+std::vector<std::shared_ptr<SceneAsset>> SimBench::loadSampleScenes() const
+{
+  AssetRegistry assetRegistry;
+  SceneManager sceneManager;
+  const ProjectSerializer projectSerializer(&assetRegistry, &sceneManager, m_componentRegistry);
+
+  // Always seeded: the procedural scenes would otherwise be laid out differently on every run.
+  projectSerializer.deserialize(buildDefaultProject(m_options.seed));
+
+  std::vector<std::shared_ptr<SceneAsset>> scenes;
+  for (const auto& scene : sceneManager.getScenes() | std::views::values)
+  {
+    if (m_options.scene.empty() || scene->getName() == m_options.scene)
+    {
+      scenes.push_back(scene);
+    }
+  }
+
+  // The manager is keyed by uuid; report in a stable order.
+  std::ranges::sort(scenes, {}, &SceneAsset::getName);
+
+  return scenes;
+}
+
+std::shared_ptr<SceneAsset> SimBench::buildSyntheticScene() const
+{
+  std::mt19937 engine(m_options.seed);
+  uuids::uuid_random_generator uuidGenerator(engine);
+
+  const auto scene = std::make_shared<SceneAsset>(uuidGenerator(),
+    std::format("Synthetic {} bodies", m_options.syntheticBodies), m_componentRegistry);
+
+  auto& objectManager = *scene->getObjectManager();
+  objectManager.seedUUIDs(m_options.seed);
+
+  // A jittered cube of spheres dropped onto one wide static box: it exercises both the dynamic pairs
+  // (the pile) and the static partition (the ground), and the pile keeps colliding as it settles.
+  constexpr float spacing = 2.5f;
+  const auto side = static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(m_options.syntheticBodies))));
+  const float extent = static_cast<float>(side) * spacing;
+
+  objectManager.instantiate(syntheticGround(extent * 2.0f));
+
+  std::uniform_real_distribution jitter(-0.25f, 0.25f);
+  std::uniform_real_distribution drift(-0.05f, 0.05f);
+
+  for (uint32_t i = 0; i < m_options.syntheticBodies; ++i)
+  {
+    const glm::vec3 cell(static_cast<float>(i % side), static_cast<float>(i / (side * side)),
+                         static_cast<float>(i / side % side));
+    const glm::vec3 position = cell * spacing - glm::vec3(extent / 2.0f, -spacing, extent / 2.0f)
+      + glm::vec3(jitter(engine), jitter(engine), jitter(engine));
+
+    objectManager.instantiate(syntheticBody(position, glm::vec3(drift(engine), 0.0f, drift(engine))));
+  }
+
+  return scene;
+}
+
+json SimBench::benchScene(const SceneAsset& scene) const
+{
+  // The server's tick length, so integration covers the same ground per tick.
+  constexpr float dt = 1.0f / 50.0f;
+
+  CollisionSystem collisionSystem;
+  collisionSystem.setDeterministic(m_options.deterministic);
+  collisionSystem.setLayerMatrix(scene.getPhysicsSettings().layerMatrix);
+
+  scene.start();
+
+  for (uint32_t i = 0; i < m_options.warmupTicks; ++i)
+  {
+    tick(scene, collisionSystem, dt);
+  }
+
+  // Drop the warmup's job timings; only the measured ticks are reported.
+  (void)JobSystem::takeStats();
+
+  TickTimes totals;
+  std::vector<double> tickSeconds;
+  tickSeconds.reserve(m_options.ticks);
+
+  const auto allocationsBefore = getAllocationCounts();
+  const auto start = Clock::now();
+
+  for (uint32_t i = 0; i < m_options.ticks; ++i)
+  {
+    const auto tickStart = Clock::now();
+    const auto times = tick(scene, collisionSystem, dt);
+    tickSeconds.push_back(secondsBetween(tickStart, Clock::now()));
+
+    totals.physicsSeconds += times.physicsSeconds;
+    totals.collisionSeconds += times.collisionSeconds;
+    totals.eventSeconds += times.eventSeconds;
+  }
+
+  const double wallSeconds = secondsBetween(start, Clock::now());
+  const auto allocationsAfter = getAllocationCounts();
+
+  const auto jobStats = JobSystem::takeStats();
+  const auto stateHash = hashSimulationState(*scene.getObjectManager());
+
+  scene.stop();
+
+  const double ticks = std::max(1.0, static_cast<double>(m_options.ticks));
+  const uint64_t allocations = allocationsAfter.allocations - allocationsBefore.allocations;
+  const uint64_t allocatedBytes = allocationsAfter.bytes - allocationsBefore.bytes;
+
+  std::ranges::sort(tickSeconds);
+
+  json jobs = json::array();
+  for (const auto& stats : jobStats)
+  {
+    jobs.push_back({
+      { "name", stats.name },
+      { "runs", stats.runs },
+      { "chunks", stats.chunks },
+      { "wallMs", stats.wallSeconds * 1000.0 },
+      { "busyMs", stats.busySeconds * 1000.0 }
+    });
+  }
+
+  // Times are per tick (means unless named), so scenes and runs of different lengths compare directly.
+  return {
+    { "scene", scene.getName() },
+    { "objects", scene.getObjectManager()->getAllObjects().size() },
+    { "substeps", scene.getPhysicsSettings().substeps },
+    { "ticks", m_options.ticks },
+    { "ticksPerSecond", wallSeconds > 0.0 ? static_cast<double>(m_options.ticks) / wallSeconds : 0.0 },
+    { "tickMs", {
+      { "mean", wallSeconds * 1000.0 / ticks },
+      { "p50", percentile(tickSeconds, 0.5) * 1000.0 },
+      { "p99", percentile(tickSeconds, 0.99) * 1000.0 },
+      { "max", tickSeconds.empty() ? 0.0 : tickSeconds.back() * 1000.0 }
+    }},
+    { "stageMs", {
+      { "physics", totals.physicsSeconds * 1000.0 / ticks },
+      { "collision", totals.collisionSeconds * 1000.0 / ticks },
+      { "events", totals.eventSeconds * 1000.0 / ticks }
+    }},
+    { "allocations", {
+      { "count", allocations },
+      { "bytes", allocatedBytes },
+      { "perTick", static_cast<double>(allocations) / ticks }
+    }},
+    { "jobs", std::move(jobs) },
+    { "stateHash", std::format("{:016x}", stateHash) }
+  };
+}
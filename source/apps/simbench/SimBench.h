@@ -0,0 +1,55 @@
+#ifndef SIMBENCH_H
+#define SIMBENCH_H
+
+#include <nlohmann/json_fwd.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ComponentRegistry;
+class SceneAsset;
+
+// Headless simulation benchmark: steps scenes through exactly the server's per-tick physics (integration
+// and collision substeps, then the tick's event commit) with no CLR, transport, scripts or clients, and
+// reports throughput, per-stage timings and heap allocations as JSON. The scenes are the built-in sample
+// project's or a synthetic N-body pile; both are seeded, so a report is comparable release over release.
+class SimBench {
+public:
+  struct Options {
+    // Measured ticks per scene, after warmupTicks untimed ones (the first ticks partition the colliders,
+    // grow the per-pass buffers and settle the bodies onto the ground).
+    uint32_t ticks = 500;
+    uint32_t warmupTicks = 50;
+    // Non-zero: bench one synthetic scene of this many falling spheres instead of the sample project.
+    uint32_t syntheticBodies = 0;
+    // Only bench the sample scene with this name (empty = every scene).
+    std::string scene;
+    // Job system worker threads (0 = one per hardware thread, less the tick thread).
+    uint32_t workers = 0;
+    // Serial, stably-ordered collision pass, as the server's --deterministic.
+    bool deterministic = false;
+    uint32_t seed = 0;
+  };
+
+  explicit SimBench(Options options);
+
+  ~SimBench();
+
+  [[nodiscard]] nlohmann::json run() const;
+
+private:
+  Options m_options;
+
+  std::shared_ptr<ComponentRegistry> m_componentRegistry;
+
+  [[nodiscard]] std::vector<std::shared_ptr<SceneAsset>> loadSampleScenes() const;
+
+  [[nodiscard]] std::shared_ptr<SceneAsset> buildSyntheticScene() const;
+
+  [[nodiscard]] nlohmann::json benchScene(const SceneAsset& scene) const;
+};
+
+
+
+#endif //SIMBENCH_H
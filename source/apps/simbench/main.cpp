@@ -0,0 +1,79 @@
+#include "SimBench.h"
+#include <nlohmann/json.hpp>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+  try
+  {
+    // Benches every scene of the built-in sample project by default; --synthetic N benches an N-body pile
+    // instead. The report goes to stdout (or --output) so CI can archive and diff it.
+    SimBench::Options options;
+    std::string output;
+
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      if (arg == "--ticks" && i + 1 < argc)
+      {
+        options.ticks = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--warmup" && i + 1 < argc)
+      {
+        options.warmupTicks = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--synthetic" && i + 1 < argc)
+      {
+        options.syntheticBodies = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--scene" && i + 1 < argc)
+      {
+        options.scene = argv[++i];
+      }
+      else if (arg == "--workers" && i + 1 < argc)
+      {
+        options.workers = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--seed" && i + 1 < argc)
+      {
+        options.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+      }
+      else if (arg == "--deterministic")
+      {
+        options.deterministic = true;
+      }
+      else if (arg == "--output" && i + 1 < argc)
+      {
+        output = argv[++i];
+      }
+    }
+
+    const SimBench bench(options);
+    const auto report = bench.run().dump(2);
+
+    if (output.empty())
+    {
+      std::cout << report << std::endl;
+    }
+    else
+    {
+      std::ofstream file(output);
+      if (!file)
+      {
+        throw std::runtime_error("Could not write '" + output + "'.");
+      }
+
+      file << report << std::endl;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
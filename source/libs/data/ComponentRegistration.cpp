@@ -6,6 +6,8 @@
 #include "objects/components/LightRenderer.h"
 #include "objects/components/collisions/BoxCollider.h"
 #include "objects/components/collisions/SphereCollider.h"
+#include "objects/components/collisions/CompoundCollider.h"
+#include "objects/components/collisions/ConvexHullCollider.h"
 #include "objects/components/Script.h"
 #include "objects/components/PlayerController.h"
 #include "objects/components/Camera.h"
@@ -22,9 +24,11 @@ void registerDataComponents(ComponentRegistry& componentRegistry)
   componentRegistry.registerComponent("LightRenderer", [] { return std::make_shared<LightRenderer>(); });
 
   // Colliders serialize as type "Collider" + a subType; they are keyed here by that subType
-  // ("Box"/"Sphere"), which Object::loadFromJSON looks up.
+  // ("Box"/"Sphere"/"Compound"/"ConvexHull"), which Object::loadFromJSON looks up.
   componentRegistry.registerComponent("Box", [] { return std::make_shared<BoxCollider>(); });
   componentRegistry.registerComponent("Sphere", [] { return std::make_shared<SphereCollider>(); });
+  componentRegistry.registerComponent("Compound", [] { return std::make_shared<CompoundCollider>(); });
+  componentRegistry.registerComponent("ConvexHull", [] { return std::make_shared<ConvexHullCollider>(); });
 
   // Script data is just className + a field blob; the live C# instance is attached by ECS3DScripting
   // (server only). loadFromJSON sets the className, so the factory is argless like the rest.
@@ -0,0 +1,108 @@
+#include "InterestGrid.h"
+#include "objects/Object.h"
+#include "objects/ObjectManager.h"
+#include "objects/components/Component.h"
+#include "objects/components/Transform.h"
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  // Cell coordinates are clamped to 21 bits a side so three pack into one key; anything further out
+  // than that many cells shares the outermost ones, which costs precision, not correctness.
+  constexpr int cellLimit = (1 << 20) - 1;
+
+  uint64_t cellKey(const glm::ivec3& cell)
+  {
+    constexpr uint64_t mask = (1u << 21) - 1;
+    return (static_cast<uint64_t>(cell.x + cellLimit) & mask)
+      | (static_cast<uint64_t>(cell.y + cellLimit) & mask) << 21
+      | (static_cast<uint64_t>(cell.z + cellLimit) & mask) << 42;
+  }
+}
+
+namespace replication {
+
+void InterestGrid::build(const ObjectManager& objectManager, const float cellSize)
+{
+  m_cellSize = cellSize > 0.0f ? cellSize : 1.0f;
+  m_cells.clear();
+  m_unplaced.clear();
+
+  for (const auto& object : objectManager.getObjects())
+  {
+    const auto transform = object->getComponent<Transform>(ComponentType::transform);
+    const auto position = transform ? transform->getPosition() : glm::vec3(NAN);
+
+    if (!std::isfinite(position.x) || !std::isfinite(position.y) || !std::isfinite(position.z))
+    {
+      m_unplaced.push_back(object);
+      continue;
+    }
+
+    m_cells[cellKey(getCell(position))].push_back({ position, object });
+  }
+}
+
+void InterestGrid::query(const glm::vec3& center, const float radius,
+                         std::vector<std::shared_ptr<Object>>& objects) const
+{
+  objects.insert(objects.end(), m_unplaced.begin(), m_unplaced.end());
+
+  const float radiusSquared = radius * radius;
+  const auto collect = [&](const std::vector<Entry>& entries) {
+    for (const auto& entry : entries)
+    {
+      const glm::vec3 offset = entry.position - center;
+      if (dot(offset, offset) <= radiusSquared)
+      {
+        objects.push_back(entry.object);
+      }
+    }
+  };
+
+  const glm::ivec3 min = getCell(center - glm::vec3(radius));
+  const glm::ivec3 max = getCell(center + glm::vec3(radius));
+
+  // A radius spanning more cells than are occupied is cheaper to answer from the occupied ones.
+  const double span = (static_cast<double>(max.x) - min.x + 1) * (static_cast<double>(max.y) - min.y + 1)
+    * (static_cast<double>(max.z) - min.z + 1);
+  if (span > static_cast<double>(m_cells.size()))
+  {
+    for (const auto& [key, entries] : m_cells)
+    {
+      collect(entries);
+    }
+
+    return;
+  }
+
+  for (int x = min.x; x <= max.x; ++x)
+  {
+    for (int y = min.y; y <= max.y; ++y)
+    {
+      for (int z = min.z; z <= max.z; ++z)
+      {
+        if (const auto cell = m_cells.find(cellKey({ x, y, z })); cell != m_cells.end())
+        {
+          collect(cell->second);
+        }
+      }
+    }
+  }
+}
+
+glm::ivec3 InterestGrid::getCell(const glm::vec3& position) const
+{
+  glm::ivec3 cell;
+
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double index = std::floor(static_cast<double>(position[axis]) / m_cellSize);
+    cell[axis] = static_cast<int>(std::clamp(index, static_cast<double>(-cellLimit), static_cast<double>(cellLimit)));
+  }
+
+  return cell;
+}
+
+}
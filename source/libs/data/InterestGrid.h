@@ -0,0 +1,47 @@
+#ifndef INTERESTGRID_H
+#define INTERESTGRID_H
+
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Object;
+class ObjectManager;
+
+namespace replication {
+
+// The scene's root objects bucketed by world position into cubic cells, for the server's area-of-interest
+// queries: finding what lies within a radius of a player visits only the cells the radius overlaps, so it
+// costs the local density rather than the whole scene. Interest is per root - a child comes and goes with
+// its root, wherever it sits. Rebuilt each tick; a cell size about the query radius keeps a query to 27
+// cells.
+class InterestGrid {
+public:
+  void build(const ObjectManager& objectManager, float cellSize);
+
+  // Append every root within radius of center to objects. Roots without a usable position (no Transform,
+  // or a non-finite one) are always included: there's no telling where they are.
+  void query(const glm::vec3& center, float radius, std::vector<std::shared_ptr<Object>>& objects) const;
+
+private:
+  struct Entry {
+    glm::vec3 position;
+    std::shared_ptr<Object> object;
+  };
+
+  float m_cellSize = 1.0f;
+
+  std::unordered_map<uint64_t, std::vector<Entry>> m_cells;
+
+  std::vector<std::shared_ptr<Object>> m_unplaced;
+
+  [[nodiscard]] glm::ivec3 getCell(const glm::vec3& position) const;
+};
+
+}
+
+
+
+#endif //INTERESTGRID_H
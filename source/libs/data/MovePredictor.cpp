@@ -0,0 +1,53 @@
+#include "MovePredictor.h"
+#include "objects/components/PlayerController.h"
+#include "objects/components/Transform.h"
+
+namespace replication {
+
+uint32_t MovePredictor::step(Transform& transform, const PlayerController& playerController,
+                             const uint8_t moveButtons, const float dt)
+{
+  playerController.move(transform, moveButtons, dt);
+
+  m_pending.push_back({ ++m_sequence, moveButtons });
+  if (m_pending.size() > maxPendingInputs)
+  {
+    m_pending.pop_front();
+  }
+
+  return m_sequence;
+}
+
+void MovePredictor::reconcile(Transform& transform, const PlayerController& playerController,
+                              const uint32_t sequence, const glm::vec3& position, const float dt)
+{
+  // An older echo than one already applied (the deltas came out of order) would rewind further than the
+  // inputs kept.
+  if (sequence < m_acked)
+  {
+    return;
+  }
+
+  m_acked = sequence;
+
+  while (!m_pending.empty() && m_pending.front().sequence <= sequence)
+  {
+    m_pending.pop_front();
+  }
+
+  transform.setPosition(position);
+
+  for (const auto& input : m_pending)
+  {
+    playerController.move(transform, input.moveButtons, dt);
+  }
+}
+
+void MovePredictor::reset()
+{
+  // The sequence carries on: the server's queue for this slot may still hold the old object's inputs.
+  m_pending.clear();
+  m_acked = 0;
+}
+
+}
@@ -0,0 +1,54 @@
+#ifndef MOVEPREDICTOR_H
+#define MOVEPREDICTOR_H
+
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <deque>
+
+class PlayerController;
+class Transform;
+
+namespace replication {
+
+// A client's prediction of its own player's built-in movement (PlayerController::move). Each tick the
+// client moves the player at once and sends the move buttons as a numbered moveInput, rather than waiting
+// a round trip for the server's delta to show the result. The server applies the inputs in order, one a
+// tick, and echoes in each delta the last it applied; the client then takes the server's position at that
+// tick and replays the inputs the server hadn't reached yet on top of it. While both ends agree that lands
+// back where the prediction was; when they don't (a collision, a script, a lost input) the server wins.
+class MovePredictor {
+public:
+  // Move transform one tick with moveButtons held and remember the input. Returns its sequence number,
+  // to send with it.
+  [[nodiscard]] uint32_t step(Transform& transform, const PlayerController& playerController,
+                              uint8_t moveButtons, float dt);
+
+  // A delta says the server had applied every input up to sequence, leaving the player at position (its
+  // local position at the delta's tick).
+  void reconcile(Transform& transform, const PlayerController& playerController, uint32_t sequence,
+                 const glm::vec3& position, float dt);
+
+  // A different object (or a rebuilt scene): forget the inputs in flight.
+  void reset();
+
+private:
+  struct Input {
+    uint32_t sequence;
+    uint8_t moveButtons;
+  };
+
+  // Enough for a couple of seconds of round trip; an input the server can't have got by then is dropped
+  // rather than replayed forever.
+  static constexpr size_t maxPendingInputs = 128;
+
+  std::deque<Input> m_pending;
+
+  uint32_t m_sequence = 0;
+  uint32_t m_acked = 0;
+};
+
+}
+
+
+
+#endif //MOVEPREDICTOR_H
@@ -14,20 +14,21 @@ ProjectPacker::ProjectPacker(AssetRegistry* assetRegistry,
     m_componentRegistry(std::move(componentRegistry))
 {}
 
-void ProjectPacker::pack(net::Message& message) const
+void ProjectPacker::pack(net::Message& message, const std::unordered_set<uint32_t>* currentSceneRoots) const
 {
   // Same shape as ProjectSerializer::serialize: the flat file assets, then every scene's object tree,
   // then the current scene uuid.
   m_assetRegistry->pack(message);
 
+  const auto currentScene = m_sceneManager->getCurrentScene();
+
   const auto& scenes = m_sceneManager->getScenes();
   message.write(static_cast<uint32_t>(scenes.size()));
   for (const auto& [uuid, scene] : scenes)
   {
-    scene->pack(message);
+    scene->pack(message, scene == currentScene ? currentSceneRoots : nullptr);
   }
 
-  const auto currentScene = m_sceneManager->getCurrentScene();
   message.writeString(currentScene ? uuids::to_string(currentScene->getUUID()) : "");
 }
 
@@ -1,7 +1,9 @@
 #ifndef PROJECTPACKER_H
 #define PROJECTPACKER_H
 
+#include <cstdint>
 #include <memory>
+#include <unordered_set>
 
 class AssetRegistry;
 class SceneManager;
@@ -23,7 +25,9 @@ public:
                 std::shared_ptr<ComponentRegistry> componentRegistry);
 
   // Writes the full project state into message (typically a MessageType::snapshot message).
-  void pack(net::Message& message) const;
+  // currentSceneRoots, if given, limits the current scene's object tree to those roots (by network id)
+  // and their subtrees: a view that only gets the objects near it.
+  void pack(net::Message& message, const std::unordered_set<uint32_t>* currentSceneRoots = nullptr) const;
 
   // Rebuilds the project from a packed snapshot. Like deserialize(), it parses into local instances
   // first and only commits (clearing + replacing the live state) once everything has parsed, so a
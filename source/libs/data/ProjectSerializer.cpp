@@ -65,6 +65,12 @@ void ProjectSerializer::deserialize(const nlohmann::json& saveData) const
       const auto scene = std::make_shared<SceneAsset>(uuid, name, m_componentRegistry);
       scene->loadObjects(sceneData.at("objects"));
 
+      // Scenes saved before per-scene physics settings existed have no such key.
+      if (sceneData.contains("physics"))
+      {
+        scene->setPhysicsSettings(PhysicsSettings::fromJSON(sceneData.at("physics")));
+      }
+
       parsedScenes.push_back(scene);
     }
   }
@@ -1,5 +1,7 @@
 #include "Replication.h"
 #include "ComponentRegistry.h"
+#include "StateHistory.h"
+#include "TransformQuantizer.h"
 #include "assets/AssetRegistry.h"
 #include "scenes/SceneManager.h"
 #include "scenes/SceneAsset.h"
@@ -10,78 +12,154 @@
 #include "objects/components/Script.h"
 #include <Protocol.h>
 #include <nlohmann/json.hpp>
-#include <cmath>
+#include <algorithm>
+#include <optional>
 
 namespace replication {
 
-void packStateDelta(net::Message& message, const ObjectManager& objectManager)
+void packStateDelta(net::Message& message, const StateHistory& history, const uint32_t simulationTick,
+                    const uint32_t baseline, const uint32_t moveSequence, const TransformQuantizer& quantizer,
+                    const Interest* interest)
 {
-  // Collect first so the entry count can lead (Message is append-only - there's no way to back-patch a
-  // header once entries are written). Each entry is uuid + the three local transform vectors.
+  // Which objects go out, and whether each must stand on its own. With a baseline: what changed since,
+  // against its value then, plus the refresh slice in full. Without one: everything in full.
   struct Entry {
-    std::string uuid;
-    glm::vec3 position;
-    glm::vec3 rotation;
-    glm::vec3 scale;
+    uint32_t networkID;
+    bool full;
   };
   std::vector<Entry> entries;
 
-  for (const auto& object : objectManager.getAllObjects())
+  const auto interested = [interest](const uint32_t networkID) {
+    return !interest || interest->contains(networkID);
+  };
+
+  if (baseline == 0)
   {
-    const auto transform = object->getComponent<Transform>(ComponentType::transform);
+    for (const auto networkID : history.getAll())
+    {
+      if (interested(networkID))
+      {
+        entries.push_back({ networkID, true });
+      }
+    }
+  }
+  else
+  {
+    for (const auto networkID : history.getChangedSince(baseline))
+    {
+      if (interested(networkID))
+      {
+        entries.push_back({ networkID, interest && interest->at(networkID) > baseline });
+      }
+    }
 
-    if (!transform || transform->getOwner() != object.get())
+    for (const auto networkID : history.getRefreshSlice())
     {
-      continue;
+      if (interested(networkID))
+      {
+        entries.push_back({ networkID, true });
+      }
+    }
+
+    if (interest)
+    {
+      for (const auto& [networkID, enteredTick] : *interest)
+      {
+        if (enteredTick > baseline)
+        {
+          entries.push_back({ networkID, true });
+        }
+      }
     }
 
-    // Send LOCAL transforms: the client rebuilds the world transform by walking parents itself, so a
-    // parent-combined value would double-count under hierarchy.
-    const auto position = transform->getLocalPosition();
-    const auto rotation = transform->getLocalRotation();
-    const auto scale = transform->getLocalScale();
+    // Sorted by id with the full entry first, so unique keeps it over the relative one.
+    std::ranges::sort(entries, [](const Entry& a, const Entry& b) {
+      return a.networkID != b.networkID ? a.networkID < b.networkID : a.full > b.full;
+    });
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+      return a.networkID == b.networkID;
+    }), entries.end());
+  }
 
-    // Skip NaN/inf rather than replicate bad data (the receiver would write it straight into the scene).
-    auto finite3 = [](const glm::vec3& v) {
-      return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
-    };
-    if (!finite3(position) || !finite3(rotation) || !finite3(scale))
+  // Resolve first so the entry count can lead (Message is append-only - there's no way to back-patch a
+  // header once entries are written). An object with no current value was destroyed since the baseline.
+  struct Resolved {
+    uint32_t networkID;
+    QuantizedTransform transform;
+    std::optional<QuantizedTransform> baseline;
+  };
+  std::vector<Resolved> resolved;
+  resolved.reserve(entries.size());
+
+  for (const auto& entry : entries)
+  {
+    auto transform = history.getState(entry.networkID, history.getTick());
+    if (!transform)
     {
       continue;
     }
 
-    entries.push_back({ uuids::to_string(object->getUUID()), position, rotation, scale });
+    resolved.push_back({ entry.networkID, *transform,
+      entry.full ? std::nullopt : history.getState(entry.networkID, baseline) });
   }
 
-  message.write(static_cast<uint32_t>(entries.size()));
-  for (const auto& entry : entries)
+  message.write(history.getTick());
+  message.write(simulationTick);
+  message.write(baseline);
+  message.writeVarint(moveSequence);
+  message.writeVarint(resolved.size());
+
+  // Ids ascend, so each is written as the gap from the last: a byte apiece for a dense set.
+  uint32_t previousID = 0;
+  for (const auto& entry : resolved)
   {
-    message.writeString(entry.uuid);
-    message.write(entry.position);
-    message.write(entry.rotation);
-    message.write(entry.scale);
+    message.writeVarint(entry.networkID - previousID);
+    previousID = entry.networkID;
+
+    quantizer.write(message, entry.transform, entry.baseline ? &*entry.baseline : nullptr);
   }
 }
 
-void unpackStateDelta(const ObjectManager& objectManager, const net::Message& message)
+uint32_t unpackStateDelta(const ObjectManager& objectManager, StateHistory& history,
+                          const TransformQuantizer& quantizer, const net::Message& message,
+                          std::vector<StateEntry>* entries)
 {
   net::MessageReader reader(message);
 
-  const uint32_t count = reader.read<uint32_t>();
-  for (uint32_t i = 0; i < count; ++i)
+  const auto tick = reader.read<uint32_t>();
+  reader.read<uint32_t>(); // the simulation tick (readSimulationTick)
+  const auto baseline = reader.read<uint32_t>();
+  reader.readVarint(); // the move sequence (readMoveSequence)
+
+  // A baseline this view no longer holds (a snapshot reset it since the ack went out) can't be decoded;
+  // leave the delta unacked and the server carries on against an older one, or sends a full delta.
+  if (tick <= history.getTick() || (baseline != 0 && !history.holds(baseline)))
+  {
+    return 0;
+  }
+
+  const uint32_t previousTick = history.getTick();
+  history.beginTick(tick);
+
+  bool complete = true;
+
+  const auto count = reader.readVarint();
+  uint32_t networkID = 0;
+  for (uint64_t i = 0; i < count; ++i)
   {
-    const auto uuid = reader.readString();
-    const auto position = reader.read<glm::vec3>();
-    const auto rotation = reader.read<glm::vec3>();
-    const auto scale = reader.read<glm::vec3>();
+    networkID += static_cast<uint32_t>(reader.readVarint());
 
-    const auto parsed = uuids::uuid::from_string(uuid);
-    if (!parsed.has_value())
+    const auto baselineState = baseline != 0 ? history.getState(networkID, baseline) : std::nullopt;
+    const auto state = quantizer.read(reader, baselineState ? &*baselineState : nullptr);
+    if (!state)
     {
+      complete = false;
       continue;
     }
 
-    const auto object = objectManager.getObjectByUUID(parsed.value());
+    history.store(networkID, *state);
+
+    const auto object = objectManager.getObjectByNetworkID(networkID);
     if (!object)
     {
       continue;
@@ -93,19 +171,80 @@ void unpackStateDelta(const ObjectManager& objectManager, const net::Message& me
       continue;
     }
 
+    if (entries)
+    {
+      entries->push_back({ networkID, quantizer.getPosition(*state), TransformQuantizer::getRotation(*state),
+                           state->scale });
+      continue;
+    }
+
     // The delta carries LOCAL transforms, so write them straight back as local values.
-    transform->setPosition(position);
-    transform->setRotation(rotation);
-    transform->setScale(scale);
+    transform->setPosition(quantizer.getPosition(*state));
+    transform->setRotation(TransformQuantizer::getRotation(*state));
+    transform->setScale(state->scale);
+  }
+
+  if (tick / StateHistory::ringTicks != previousTick / StateHistory::ringTicks)
+  {
+    history.forgetMissing(objectManager);
   }
+
+  // An entry that couldn't be decoded leaves this tick's history short of the server's; acking it would
+  // let later deltas be encoded against a value this view doesn't have.
+  return complete ? tick : 0;
+}
+
+net::Message buildStateAck(const uint32_t tick)
+{
+  net::Message message(net::MessageType::stateAck);
+  message.write(tick);
+  return message;
+}
+
+uint32_t readStateAck(const net::Message& message)
+{
+  net::MessageReader reader(message);
+  return reader.read<uint32_t>();
 }
 
-net::Message buildComponentEdit(const uuids::uuid& objectUUID,
+uint32_t readSimulationTick(const net::Message& delta)
+{
+  net::MessageReader reader(delta);
+  reader.read<uint32_t>();
+  return reader.read<uint32_t>();
+}
+
+uint32_t readMoveSequence(const net::Message& delta)
+{
+  net::MessageReader reader(delta);
+  reader.read<uint32_t>();
+  reader.read<uint32_t>();
+  reader.read<uint32_t>();
+  return static_cast<uint32_t>(reader.readVarint());
+}
+
+net::Message buildMoveInput(const uint32_t sequence, const uint8_t moveButtons)
+{
+  net::Message message(net::MessageType::moveInput);
+  message.write(sequence);
+  message.write(moveButtons);
+  return message;
+}
+
+std::pair<uint32_t, uint8_t> readMoveInput(const net::Message& message)
+{
+  net::MessageReader reader(message);
+  const auto sequence = reader.read<uint32_t>();
+  const auto moveButtons = reader.read<uint8_t>();
+  return { sequence, moveButtons };
+}
+
+net::Message buildComponentEdit(const uint32_t objectNetworkID,
                                 const std::shared_ptr<Component>& component)
 {
   net::Message message(net::MessageType::editComponent);
 
-  message.writeString(uuids::to_string(objectUUID));
+  message.write(objectNetworkID);
   component->pack(message);
 
   return message;
@@ -114,14 +253,8 @@ net::Message buildComponentEdit(const uuids::uuid& objectUUID,
 void applyComponentEdit(const ObjectManager& objectManager, const net::Message& edit)
 {
   net::MessageReader reader(edit);
-  const auto objectUUIDString = reader.readString();
-  const auto objectUUID = uuids::uuid::from_string(objectUUIDString);
-  if (!objectUUID.has_value())
-  {
-    return;
-  }
 
-  const auto object = objectManager.getObjectByUUID(objectUUID.value());
+  const auto object = objectManager.getObjectByNetworkID(reader.read<uint32_t>());
   if (!object)
   {
     return;
@@ -451,10 +584,10 @@ net::Message buildObjectSpawned(const Object& object)
   return message;
 }
 
-net::Message buildObjectDestroyed(const uuids::uuid& objectUUID)
+net::Message buildObjectDestroyed(const uint32_t objectNetworkID)
 {
   net::Message message(net::MessageType::objectDestroyed);
-  message.writeString(uuids::to_string(objectUUID));
+  message.write(objectNetworkID);
   return message;
 }
 
@@ -473,13 +606,7 @@ void applyObjectDestroyed(ObjectManager& objectManager, const net::Message& mess
 {
   net::MessageReader reader(message);
 
-  const auto parsed = uuids::uuid::from_string(reader.readString());
-  if (!parsed.has_value())
-  {
-    return;
-  }
-
-  const auto object = objectManager.getObjectByUUID(parsed.value());
+  const auto object = objectManager.getObjectByNetworkID(reader.read<uint32_t>());
   if (!object)
   {
     return;
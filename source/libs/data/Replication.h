@@ -2,7 +2,12 @@
 #define REPLICATION_H
 
 #include <nlohmann/json_fwd.hpp>
+#include <glm/vec3.hpp>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <uuid.h>
 
 class Object;
@@ -11,27 +16,84 @@ class Component;
 class AssetRegistry;
 class SceneManager;
 class ComponentRegistry;
+class TransformQuantizer;
 
 namespace net {
   class Message;
 }
 
 // Per-tick state replication. The full Snapshot (on join) is the packed project blob (ProjectPacker);
-// the StateDelta is the lighter per-tick stream: each object's uuid + local transform, packed as binary
-// straight into the message (count-prefixed entries) rather than JSON. The server packs it from its
-// authoritative scene, the client unpacks it into its replicated view. This lives in ECS3DData (it
-// reads/writes the scene data); the net layer only carries the resulting bytes.
+// the StateDelta is the lighter per-tick stream of local transforms, packed as binary straight into the
+// message rather than JSON. Positions and rotations are quantized on the scene's grid (TransformQuantizer
+// over its PhysicsSettings), so both ends must build the quantizer from the same scene's settings.
+//
+// Each delta is encoded against a baseline: the last tick the receiving client acked (buildStateAck) and
+// the server still holds in its StateHistory. It carries every object whose value changed since then, as
+// a difference from the value at the baseline - a few bytes for an object that moved a little - plus the
+// tick's refresh slice in full. With no usable baseline (a new client, a reset, an ack that aged out) it
+// carries every object in full. Both ends keep a StateHistory, so the client can decode against any tick
+// it acked. The server packs it from its authoritative scene, the client unpacks it into its replicated
+// view. This lives in ECS3DData (it reads/writes the scene data); the net layer only carries the bytes.
 namespace replication {
 
-void packStateDelta(net::Message& message, const ObjectManager& objectManager);
-
-void unpackStateDelta(const ObjectManager& objectManager, const net::Message& message);
-
-// The editor's return path: a single component edit, carried as { object, type, [className], data },
-// where data is the component's own serialize() blob. The server applies it to its authoritative scene
-// (reusing each component's loadFromJSON) and re-broadcasts so every view converges. Reuses the
-// existing serialize()/loadFromJSON boundary - the net layer never names a component type.
-[[nodiscard]] net::Message buildComponentEdit(const uuids::uuid& objectUUID,
+class StateHistory;
+
+// Every delta sends the refresh slice of 1/refreshTicks of the objects in full, so an object left stale
+// (a wrapped uint8 update id, a value some path set without bumping it) is put right within that many
+// ticks, without ever sending the whole scene at once.
+constexpr uint32_t refreshTicks = 500;
+
+// A client's area of interest: the network ids its deltas may name (the objects it has), each with the
+// delta tick it came into interest. One that came in after the baseline goes out in full whether it
+// changed or not - the client had nothing at the baseline to difference it against.
+using Interest = std::unordered_map<uint32_t, uint32_t>;
+
+// Pack history's current tick against baseline (0, or a tick history holds), limited to interest when
+// one is given. simulationTick is the server's simulation tick count the state is from: history's ticks
+// count deltas sent, which lag it whenever a frame runs several simulation steps, so a view timing the
+// stream (TransformInterpolator) goes by this instead. moveSequence is the last of the receiving client's
+// moveInputs applied by this tick (0 for none): its state in the delta is where that input left it, and
+// what the client replays the later ones from.
+void packStateDelta(net::Message& message, const StateHistory& history, uint32_t simulationTick,
+                    uint32_t baseline, uint32_t moveSequence, const TransformQuantizer& quantizer,
+                    const Interest* interest = nullptr);
+
+// One object's decoded local transform from a delta, for a view that applies the stream itself.
+struct StateEntry {
+  uint32_t networkID;
+  glm::vec3 position;
+  glm::vec3 rotation;
+  glm::vec3 scale;
+};
+
+// Apply a delta to objectManager and record it in history. Returns the tick to ack, or 0 when the delta
+// can't be used whole - its baseline isn't one history holds, or it came out of order - and shouldn't be
+// acked (the server carries on against the older baseline, or falls back to a full delta).
+// With entries given, the values of objects present in objectManager are appended there (the delta's tick
+// is then history.getTick()) instead of written into the scene.
+[[nodiscard]] uint32_t unpackStateDelta(const ObjectManager& objectManager, StateHistory& history,
+                                        const TransformQuantizer& quantizer, const net::Message& message,
+                                        std::vector<StateEntry>* entries = nullptr);
+
+[[nodiscard]] net::Message buildStateAck(uint32_t tick);
+
+[[nodiscard]] uint32_t readStateAck(const net::Message& message);
+
+[[nodiscard]] uint32_t readSimulationTick(const net::Message& delta);
+
+[[nodiscard]] uint32_t readMoveSequence(const net::Message& delta);
+
+// One tick of a predicting client's movement: the PlayerController move buttons it held, numbered from 1
+// in tick order.
+[[nodiscard]] net::Message buildMoveInput(uint32_t sequence, uint8_t moveButtons);
+
+[[nodiscard]] std::pair<uint32_t, uint8_t> readMoveInput(const net::Message& message);
+
+// The editor's return path: a single component edit, carried as the object's network id followed by the
+// component's own pack() (type discriminator, [className], fields). The server applies it to its
+// authoritative scene (reusing each component's unpack) and re-broadcasts so every view converges. Reuses
+// the existing pack()/unpack() boundary - the net layer never names a component type.
+[[nodiscard]] net::Message buildComponentEdit(uint32_t objectNetworkID,
                                               const std::shared_ptr<Component>& component);
 
 void applyComponentEdit(const ObjectManager& objectManager, const net::Message& edit);
@@ -72,11 +134,11 @@ void applySceneEdit(ObjectManager& objectManager, const nlohmann::json& edit,
 
 // Runtime spawn/destroy replication. Unlike the editor's structural edits (which re-snapshot), a script
 // spawning or destroying an object at runtime replicates incrementally: the server broadcasts one packed
-// object (spawn) or a uuid (destroy), and each view splices it into / out of its replicated scene. Keeps
+// object (spawn, which carries its network id) or a network id (destroy), and each view splices it into / out of its replicated scene. Keeps
 // frequent runtime spawning off the full-snapshot path.
 [[nodiscard]] net::Message buildObjectSpawned(const Object& object);
 
-[[nodiscard]] net::Message buildObjectDestroyed(const uuids::uuid& objectUUID);
+[[nodiscard]] net::Message buildObjectDestroyed(uint32_t objectNetworkID);
 
 void applyObjectSpawned(ObjectManager& objectManager, const net::Message& message);
 
@@ -0,0 +1,210 @@
+#include "StateHistory.h"
+#include "objects/Object.h"
+#include "objects/ObjectManager.h"
+#include "objects/components/Component.h"
+#include "objects/components/Transform.h"
+#include <algorithm>
+#include <cmath>
+
+namespace replication {
+
+uint32_t StateHistory::getTick() const
+{
+  return m_tick;
+}
+
+bool StateHistory::holds(const uint32_t tick) const
+{
+  return tick != 0 && tick >= m_firstTick && tick <= m_tick && m_tick - tick < ringTicks;
+}
+
+void StateHistory::record(const ObjectManager& objectManager, const TransformQuantizer& quantizer,
+                          const uint32_t refreshTicks)
+{
+  beginTick(m_tick + 1);
+
+  const uint32_t refreshEvery = std::max(refreshTicks, 1u);
+  const uint32_t refreshSlice = m_tick % refreshEvery;
+  m_refreshSlice.clear();
+
+  size_t seen = 0;
+  for (const auto& object : objectManager.getAllObjects())
+  {
+    const auto transform = object->getComponent<Transform>(ComponentType::transform);
+
+    if (!transform || transform->getOwner() != object.get())
+    {
+      continue;
+    }
+
+    const auto networkID = object->getNetworkID();
+    const auto updateID = transform->getUpdateID();
+    const bool refresh = networkID % refreshEvery == refreshSlice;
+
+    auto [entry, firstSighting] = m_objects.try_emplace(networkID);
+    auto& history = entry->second;
+    history.seenTick = m_tick;
+    ++seen;
+
+    if (firstSighting || refresh || history.updateID != updateID)
+    {
+      // Record LOCAL transforms: the client rebuilds the world transform by walking parents itself, so a
+      // parent-combined value would double-count under hierarchy.
+      const auto position = transform->getLocalPosition();
+      const auto rotation = transform->getLocalRotation();
+      const auto scale = transform->getLocalScale();
+
+      // Skip NaN/inf rather than replicate bad data (the receiver would write it straight into the
+      // scene); the last good value stands.
+      auto finite3 = [](const glm::vec3& v) {
+        return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+      };
+      if (finite3(position) && finite3(rotation) && finite3(scale))
+      {
+        history.updateID = updateID;
+        storeRecord(networkID, history, quantizer.quantize(position, rotation, scale));
+      }
+    }
+
+    if (refresh && !history.records.empty())
+    {
+      m_refreshSlice.push_back(networkID);
+    }
+  }
+
+  // Something recorded before wasn't seen this tick: it was destroyed (or lost its Transform).
+  if (seen != m_objects.size())
+  {
+    std::erase_if(m_objects, [this](const auto& entry) { return entry.second.seenTick != m_tick; });
+  }
+}
+
+void StateHistory::beginTick(const uint32_t tick)
+{
+  if (tick <= m_tick)
+  {
+    return;
+  }
+
+  // The slots of any ticks skipped, and of the new one, still list a tick ringTicks back.
+  for (uint32_t skipped = m_tick + 1; skipped <= tick && skipped - m_tick <= ringTicks; ++skipped)
+  {
+    m_changed[skipped % ringTicks].clear();
+  }
+
+  m_tick = tick;
+}
+
+void StateHistory::store(const uint32_t networkID, const QuantizedTransform& transform)
+{
+  storeRecord(networkID, m_objects[networkID], transform);
+}
+
+std::optional<QuantizedTransform> StateHistory::getState(const uint32_t networkID, const uint32_t tick) const
+{
+  const auto history = m_objects.find(networkID);
+  if (history == m_objects.end())
+  {
+    return std::nullopt;
+  }
+
+  const auto& records = history->second.records;
+  for (auto record = records.rbegin(); record != records.rend(); ++record)
+  {
+    if (record->tick <= tick)
+    {
+      return record->transform;
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::vector<uint32_t> StateHistory::getChangedSince(const uint32_t baseline) const
+{
+  std::vector<uint32_t> changed;
+
+  for (uint32_t tick = baseline + 1; tick <= m_tick; ++tick)
+  {
+    const auto& slot = m_changed[tick % ringTicks];
+    changed.insert(changed.end(), slot.begin(), slot.end());
+  }
+
+  std::ranges::sort(changed);
+  changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+  return changed;
+}
+
+std::vector<uint32_t> StateHistory::getAll() const
+{
+  std::vector<uint32_t> all;
+  all.reserve(m_objects.size());
+
+  for (const auto& [networkID, history] : m_objects)
+  {
+    if (!history.records.empty())
+    {
+      all.push_back(networkID);
+    }
+  }
+
+  std::ranges::sort(all);
+
+  return all;
+}
+
+const std::vector<uint32_t>& StateHistory::getRefreshSlice() const
+{
+  return m_refreshSlice;
+}
+
+void StateHistory::forgetMissing(const ObjectManager& objectManager)
+{
+  std::erase_if(m_objects, [&objectManager](const auto& entry) {
+    return objectManager.getObjectByNetworkID(entry.first) == nullptr;
+  });
+}
+
+void StateHistory::reset()
+{
+  m_objects.clear();
+  m_refreshSlice.clear();
+
+  for (auto& slot : m_changed)
+  {
+    slot.clear();
+  }
+
+  m_firstTick = m_tick + 1;
+}
+
+void StateHistory::storeRecord(const uint32_t networkID, ObjectHistory& history, const QuantizedTransform& transform)
+{
+  auto& records = history.records;
+
+  if (!records.empty() && records.back().transform == transform)
+  {
+    return;
+  }
+
+  if (!records.empty() && records.back().tick == m_tick)
+  {
+    records.back().transform = transform;
+  }
+  else
+  {
+    records.push_back({ m_tick, transform });
+  }
+
+  m_changed[m_tick % ringTicks].push_back(networkID);
+
+  // The oldest tick still held takes its value from the newest record at or before it; anything older than
+  // that record can't be asked for again.
+  while (records.size() >= 2 && records[1].tick + ringTicks <= m_tick + 1)
+  {
+    records.erase(records.begin());
+  }
+}
+
+}
@@ -0,0 +1,90 @@
+#ifndef STATEHISTORY_H
+#define STATEHISTORY_H
+
+#include "TransformQuantizer.h"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+class ObjectManager;
+
+namespace replication {
+
+// The quantized transform of every replicated object over the last ringTicks state-delta ticks: the
+// baselines the per-client deltas are encoded against. The server records it from its scene each tick;
+// a client stores what each delta it applies gives it, so it holds the same value for every tick it could
+// ack. Only changes are kept - an object's history is its value at each tick it changed, plus the newest
+// value from before the window - so a static object costs one record however long it stands still.
+class StateHistory {
+public:
+  static constexpr uint32_t ringTicks = 64;
+
+  // Tick 0 is never recorded, so it means "no baseline" on the wire.
+  [[nodiscard]] uint32_t getTick() const;
+
+  // Whether tick's state can still be reconstructed: recorded since the last reset, and within the window.
+  [[nodiscard]] bool holds(uint32_t tick) const;
+
+  // Server side: advance a tick and record every object whose Transform update id moved, quantized on
+  // quantizer's grid. Objects in this tick's refresh slice (network id % refreshTicks) are requantized
+  // whatever their id says, so a wrapped uint8 id or an unbumped write can't leave one stale for good;
+  // getRefreshSlice lists them for the deltas to send in full. An object gone from objectManager is
+  // dropped the first tick it's missing, so no delta names it after its objectDestroyed.
+  void record(const ObjectManager& objectManager, const TransformQuantizer& quantizer, uint32_t refreshTicks);
+
+  // Client side: advance to the delta's tick (ticks may skip, never go back), then store its entries.
+  void beginTick(uint32_t tick);
+  void store(uint32_t networkID, const QuantizedTransform& transform);
+
+  // An object's value as of tick, or nullopt if it wasn't recorded by then (spawned since) or has aged out.
+  [[nodiscard]] std::optional<QuantizedTransform> getState(uint32_t networkID, uint32_t tick) const;
+
+  // The ids of the objects whose value changed after baseline, up to the current tick, sorted and unique.
+  // baseline must be held.
+  [[nodiscard]] std::vector<uint32_t> getChangedSince(uint32_t baseline) const;
+
+  // Every recorded object's id, sorted - for a delta with no baseline, which sends everything.
+  [[nodiscard]] std::vector<uint32_t> getAll() const;
+
+  [[nodiscard]] const std::vector<uint32_t>& getRefreshSlice() const;
+
+  // Client side: drop the history of objects no longer in objectManager (destroyed). Cheap enough to run
+  // every ringTicks ticks rather than hooking every removal path.
+  void forgetMissing(const ObjectManager& objectManager);
+
+  // Forget everything (a snapshot replaced the state). The tick counter carries on, so acks of ticks from
+  // before the reset are never mistaken for ones after it.
+  void reset();
+
+private:
+  struct Record {
+    uint32_t tick;
+    QuantizedTransform transform;
+  };
+
+  struct ObjectHistory {
+    std::vector<Record> records;
+    uint8_t updateID = 0;
+    uint32_t seenTick = 0;
+  };
+
+  std::unordered_map<uint32_t, ObjectHistory> m_objects;
+
+  // The ids that changed at each tick, indexed by tick % ringTicks.
+  std::array<std::vector<uint32_t>, ringTicks> m_changed;
+
+  std::vector<uint32_t> m_refreshSlice;
+
+  uint32_t m_tick = 0;
+  uint32_t m_firstTick = 1;
+
+  void storeRecord(uint32_t networkID, ObjectHistory& history, const QuantizedTransform& transform);
+};
+
+}
+
+
+
+#endif //STATEHISTORY_H
@@ -0,0 +1,261 @@
+#include "TransformQuantizer.h"
+#include "scenes/PhysicsSettings.h"
+#include <Protocol.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace {
+  constexpr double angleSteps = 65536.0;
+
+  // The flags byte leading each entry.
+  constexpr uint8_t entryHasScale = 1 << 0;      // scale follows; otherwise it's the baseline's
+  constexpr uint8_t entryFloatPosition = 1 << 1; // position is three floats: it's outside the bounds
+  constexpr uint8_t entryRelative = 1 << 2;      // position and rotation are differences from the baseline
+
+  uint32_t bytesFor(const double steps)
+  {
+    if (steps <= 0xFF)
+    {
+      return 1;
+    }
+
+    if (steps <= 0xFFFF)
+    {
+      return 2;
+    }
+
+    return steps <= 0xFFFFFF ? 3 : 4;
+  }
+
+  // Signed differences as varints: zigzag folds small negatives onto small positives (0, -1, 1, -2 ...).
+  void writeSigned(net::Message& message, const int64_t value)
+  {
+    message.writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+  }
+
+  int64_t readSigned(net::MessageReader& messageReader)
+  {
+    const uint64_t value = messageReader.readVarint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  bool fitsBounds(const glm::vec3& position, const glm::vec3& min, const glm::vec3& max)
+  {
+    // Written so a NaN fails every comparison and lands outside.
+    return position.x >= min.x && position.x <= max.x
+      && position.y >= min.y && position.y <= max.y
+      && position.z >= min.z && position.z <= max.z;
+  }
+}
+
+TransformQuantizer::TransformQuantizer(const PhysicsSettings& settings)
+  : m_min(settings.replicationBoundsMin),
+    m_max(settings.replicationBoundsMax)
+{
+  // A step no coarser than the precision asked for, but no more of them than four bytes can count.
+  double mostSteps = 1.0;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double range = static_cast<double>(m_max[axis]) - m_min[axis];
+    const double steps = std::clamp(std::ceil(range / settings.positionPrecision), 1.0,
+                                    static_cast<double>(std::numeric_limits<uint32_t>::max()));
+
+    m_step[axis] = static_cast<float>(range / steps);
+    m_stepCount[axis] = static_cast<uint32_t>(steps);
+    mostSteps = std::max(mostSteps, steps);
+  }
+
+  m_positionBytes = bytesFor(mostSteps);
+}
+
+QuantizedTransform TransformQuantizer::quantize(const glm::vec3& position, const glm::vec3& rotation,
+                                                const glm::vec3& scale) const
+{
+  QuantizedTransform transform;
+  transform.scale = scale;
+  transform.floatPosition = !fitsBounds(position, m_min, m_max);
+
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    if (transform.floatPosition)
+    {
+      transform.position[axis] = std::bit_cast<uint32_t>(position[axis]);
+    }
+    else
+    {
+      const double steps = std::round((static_cast<double>(position[axis]) - m_min[axis]) / m_step[axis]);
+      transform.position[axis] = static_cast<uint32_t>(std::clamp(steps, 0.0, static_cast<double>(m_stepCount[axis])));
+    }
+
+    // Offset into [0, 360) so the full circle maps onto the 16 bits; 360 itself rounds back round to 0.
+    const double turn = std::fmod(static_cast<double>(rotation[axis]) + 180.0, 360.0);
+    const double wrapped = turn < 0.0 ? turn + 360.0 : turn;
+    transform.rotation[axis] = static_cast<uint16_t>(static_cast<uint32_t>(std::round(wrapped / 360.0 * angleSteps)) & 0xFFFFu);
+  }
+
+  return transform;
+}
+
+glm::vec3 TransformQuantizer::getPosition(const QuantizedTransform& transform) const
+{
+  glm::vec3 position;
+
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    position[axis] = transform.floatPosition
+      ? std::bit_cast<float>(transform.position[axis])
+      : static_cast<float>(m_min[axis] + static_cast<double>(transform.position[axis]) * m_step[axis]);
+  }
+
+  return position;
+}
+
+glm::vec3 TransformQuantizer::getRotation(const QuantizedTransform& transform)
+{
+  glm::vec3 rotation;
+
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    rotation[axis] = static_cast<float>(transform.rotation[axis] / angleSteps * 360.0 - 180.0);
+  }
+
+  return rotation;
+}
+
+void TransformQuantizer::write(net::Message& message, const QuantizedTransform& transform,
+                               const QuantizedTransform* baseline) const
+{
+  // Float positions aren't on the grid, so there's nothing meaningful to difference them against.
+  const bool relative = baseline && !transform.floatPosition && !baseline->floatPosition;
+
+  uint8_t flags = 0;
+  if (!baseline || transform.scale != baseline->scale)
+  {
+    flags |= entryHasScale;
+  }
+
+  if (transform.floatPosition)
+  {
+    flags |= entryFloatPosition;
+  }
+
+  if (relative)
+  {
+    flags |= entryRelative;
+  }
+
+  message.write(flags);
+
+  if (relative)
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      writeSigned(message, static_cast<int64_t>(transform.position[axis]) - baseline->position[axis]);
+    }
+
+    // Angles wrap, so the short way round: 359 -> 1 degree is +2, not -358.
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      writeSigned(message, static_cast<int16_t>(static_cast<uint16_t>(transform.rotation[axis] - baseline->rotation[axis])));
+    }
+  }
+  else
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (transform.floatPosition)
+      {
+        message.write(transform.position[axis]);
+        continue;
+      }
+
+      // Little-endian, only as many bytes as the grid needs.
+      for (uint32_t byte = 0; byte < m_positionBytes; ++byte)
+      {
+        message.write(static_cast<uint8_t>(transform.position[axis] >> (byte * 8)));
+      }
+    }
+
+    message.write(transform.rotation);
+  }
+
+  if (flags & entryHasScale)
+  {
+    message.write(transform.scale);
+  }
+}
+
+std::optional<QuantizedTransform> TransformQuantizer::read(net::MessageReader& messageReader,
+                                                           const QuantizedTransform* baseline) const
+{
+  const auto flags = messageReader.read<uint8_t>();
+
+  QuantizedTransform transform;
+  transform.floatPosition = (flags & entryFloatPosition) != 0;
+
+  // Read the whole entry whatever happens, so a missing baseline costs this entry and not the rest.
+  bool complete = true;
+
+  if (flags & entryRelative)
+  {
+    std::array<int64_t, 3> position{};
+    std::array<int64_t, 3> rotation{};
+    for (auto& axis : position)
+    {
+      axis = readSigned(messageReader);
+    }
+    for (auto& axis : rotation)
+    {
+      axis = readSigned(messageReader);
+    }
+
+    complete = baseline != nullptr;
+    for (int axis = 0; complete && axis < 3; ++axis)
+    {
+      transform.position[axis] = static_cast<uint32_t>(baseline->position[axis] + position[axis]);
+      transform.rotation[axis] = static_cast<uint16_t>(baseline->rotation[axis] + rotation[axis]);
+    }
+  }
+  else
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (transform.floatPosition)
+      {
+        transform.position[axis] = messageReader.read<uint32_t>();
+        continue;
+      }
+
+      uint32_t value = 0;
+      for (uint32_t byte = 0; byte < m_positionBytes; ++byte)
+      {
+        value |= static_cast<uint32_t>(messageReader.read<uint8_t>()) << (byte * 8);
+      }
+      transform.position[axis] = value;
+    }
+
+    transform.rotation = messageReader.read<std::array<uint16_t, 3>>();
+  }
+
+  if (flags & entryHasScale)
+  {
+    transform.scale = messageReader.read<glm::vec3>();
+  }
+  else if (baseline)
+  {
+    transform.scale = baseline->scale;
+  }
+  else
+  {
+    complete = false;
+  }
+
+  return complete ? std::optional(transform) : std::nullopt;
+}
+
+uint32_t TransformQuantizer::getPositionBytes() const
+{
+  return m_positionBytes;
+}
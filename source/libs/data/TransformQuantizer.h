@@ -0,0 +1,72 @@
+#ifndef TRANSFORMQUANTIZER_H
+#define TRANSFORMQUANTIZER_H
+
+#include <glm/vec3.hpp>
+#include <array>
+#include <cstdint>
+#include <optional>
+
+struct PhysicsSettings;
+
+namespace net {
+  class Message;
+  class MessageReader;
+}
+
+// A local transform on a TransformQuantizer's grid: what the state delta actually replicates, and what
+// both ends keep per tick as the baselines later deltas are encoded against.
+struct QuantizedTransform {
+  // Grid steps from the bounds' minimum, or the raw float bits when floatPosition (outside the bounds).
+  std::array<uint32_t, 3> position{};
+  std::array<uint16_t, 3> rotation{};
+  glm::vec3 scale{ 1.0f };
+  bool floatPosition = false;
+
+  bool operator==(const QuantizedTransform&) const = default;
+};
+
+// The state delta's compact transform encoding, built from the scene's PhysicsSettings on both ends so
+// they agree on the grid without sending it:
+//  - position: per axis, the whole number of positionPrecision steps from replicationBoundsMin, in the
+//    fewest bytes that hold the bounds' step count. Off by at most half a step per axis.
+//  - rotation: each Euler angle wrapped to [-180, 180) and stored as 16 bits. Off by at most 180/65536
+//    degrees per axis (the wrapped angle is the same orientation).
+//  - scale: full floats, exact.
+// Every quantized value is absolute - a delta against a baseline is exact integer arithmetic on the grid -
+// so the error stays within those bounds however many deltas an object goes through rather than drifting.
+class TransformQuantizer {
+public:
+  explicit TransformQuantizer(const PhysicsSettings& settings);
+
+  [[nodiscard]] QuantizedTransform quantize(const glm::vec3& position, const glm::vec3& rotation,
+                                            const glm::vec3& scale) const;
+
+  [[nodiscard]] glm::vec3 getPosition(const QuantizedTransform& transform) const;
+  [[nodiscard]] static glm::vec3 getRotation(const QuantizedTransform& transform);
+
+  // One entry: a flags byte, then the position and rotation - as the difference from baseline (zigzag
+  // varints, a byte or two for an object that moved a little) when there is one, else in full - then the
+  // scale only when it differs from baseline's. Pass no baseline for an entry that must stand on its own.
+  void write(net::Message& message, const QuantizedTransform& transform,
+             const QuantizedTransform* baseline = nullptr) const;
+
+  // The pairing read. The entry's bytes are always consumed; nullopt when it was written against a
+  // baseline and none is given, so the caller can skip it and carry on with the next.
+  [[nodiscard]] std::optional<QuantizedTransform> read(net::MessageReader& messageReader,
+                                                       const QuantizedTransform* baseline = nullptr) const;
+
+  // Bytes per position axis in a full entry (1-4).
+  [[nodiscard]] uint32_t getPositionBytes() const;
+
+private:
+  glm::vec3 m_min;
+  glm::vec3 m_max;
+  glm::vec3 m_step;
+
+  std::array<uint32_t, 3> m_stepCount{};
+  uint32_t m_positionBytes;
+};
+
+
+
+#endif //TRANSFORMQUANTIZER_H
@@ -0,0 +1,262 @@
+#include "ModelVertices.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+  // Binary glTF container: a 12-byte header, then length/type-prefixed chunks (JSON first, then BIN).
+  constexpr uint32_t glbMagic = 0x46546C67;      // "glTF"
+  constexpr uint32_t glbJsonChunk = 0x4E4F534A;  // "JSON"
+  constexpr uint32_t glbBinaryChunk = 0x004E4942; // "BIN\0"
+
+  constexpr int floatComponentType = 5126;
+
+  struct Document {
+    nlohmann::json gltf;
+    std::vector<std::vector<char>> buffers;
+  };
+
+  std::vector<char> readFile(const std::filesystem::path& path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+      throw std::runtime_error("loadModelVertices::Could not open " + path.string());
+    }
+
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+  }
+
+  // glTF is little-endian throughout, as is every platform this builds for.
+  uint32_t readUint32(const std::vector<char>& data, const size_t offset)
+  {
+    if (offset + sizeof(uint32_t) > data.size())
+    {
+      throw std::runtime_error("loadModelVertices::Truncated GLB");
+    }
+
+    uint32_t value = 0;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+  }
+
+  Document readGlb(const std::filesystem::path& path)
+  {
+    const auto data = readFile(path);
+
+    if (readUint32(data, 0) != glbMagic)
+    {
+      throw std::runtime_error("loadModelVertices::Not a GLB file " + path.string());
+    }
+
+    Document document;
+    bool hasJson = false;
+
+    for (size_t offset = 12; offset + 8 <= data.size();)
+    {
+      const uint32_t length = readUint32(data, offset);
+      const uint32_t type = readUint32(data, offset + 4);
+      const size_t begin = offset + 8;
+
+      if (begin + length > data.size())
+      {
+        throw std::runtime_error("loadModelVertices::Truncated GLB chunk");
+      }
+
+      if (type == glbJsonChunk)
+      {
+        document.gltf = nlohmann::json::parse(data.begin() + static_cast<std::ptrdiff_t>(begin),
+                                              data.begin() + static_cast<std::ptrdiff_t>(begin + length));
+        hasJson = true;
+      }
+      else if (type == glbBinaryChunk && document.buffers.empty())
+      {
+        // Buffer 0 of a GLB is its BIN chunk.
+        document.buffers.emplace_back(data.begin() + static_cast<std::ptrdiff_t>(begin),
+                                      data.begin() + static_cast<std::ptrdiff_t>(begin + length));
+      }
+
+      offset = begin + length;
+    }
+
+    if (!hasJson)
+    {
+      throw std::runtime_error("loadModelVertices::GLB has no JSON chunk");
+    }
+
+    return document;
+  }
+
+  Document readGltf(const std::filesystem::path& path)
+  {
+    const auto data = readFile(path);
+
+    Document document;
+    document.gltf = nlohmann::json::parse(data.begin(), data.end());
+
+    for (const auto& buffer : document.gltf.value("buffers", nlohmann::json::array()))
+    {
+      const std::string uri = buffer.value("uri", "");
+      if (uri.empty() || uri.starts_with("data:"))
+      {
+        throw std::runtime_error("loadModelVertices::Only external .gltf buffers are supported");
+      }
+
+      document.buffers.push_back(readFile(path.parent_path() / uri));
+    }
+
+    return document;
+  }
+
+  glm::mat4 nodeMatrix(const nlohmann::json& node)
+  {
+    if (const auto matrix = node.find("matrix"); matrix != node.end())
+    {
+      // Column-major, as glm stores it.
+      glm::mat4 result(1.0f);
+      for (int i = 0; i < 16; ++i)
+      {
+        result[i / 4][i % 4] = matrix->at(i).get<float>();
+      }
+      return result;
+    }
+
+    const auto translation = node.value("translation", std::vector<float>{ 0.0f, 0.0f, 0.0f });
+    const auto rotation = node.value("rotation", std::vector<float>{ 0.0f, 0.0f, 0.0f, 1.0f });
+    const auto scale = node.value("scale", std::vector<float>{ 1.0f, 1.0f, 1.0f });
+
+    // glTF quaternions are x, y, z, w; glm's constructor takes w first.
+    const glm::quat orientation(rotation.at(3), rotation.at(0), rotation.at(1), rotation.at(2));
+
+    return translate(glm::mat4(1.0f), glm::vec3(translation.at(0), translation.at(1), translation.at(2)))
+      * mat4_cast(orientation)
+      * glm::scale(glm::mat4(1.0f), glm::vec3(scale.at(0), scale.at(1), scale.at(2)));
+  }
+
+  void appendPositions(const Document& document, const size_t accessorIndex, const glm::mat4& matrix,
+                       std::vector<glm::vec3>& vertices)
+  {
+    const auto& accessor = document.gltf.at("accessors").at(accessorIndex);
+
+    if (accessor.at("componentType").get<int>() != floatComponentType || accessor.at("type") != "VEC3")
+    {
+      throw std::runtime_error("loadModelVertices::POSITION must be float VEC3");
+    }
+
+    if (!accessor.contains("bufferView"))
+    {
+      return; // all zeros until a sparse substitution, which isn't read here
+    }
+
+    const auto& view = document.gltf.at("bufferViews").at(accessor.at("bufferView").get<size_t>());
+    const auto bufferIndex = view.at("buffer").get<size_t>();
+    if (bufferIndex >= document.buffers.size())
+    {
+      throw std::runtime_error("loadModelVertices::Missing buffer");
+    }
+
+    const auto& buffer = document.buffers[bufferIndex];
+    const size_t offset = view.value("byteOffset", size_t{ 0 }) + accessor.value("byteOffset", size_t{ 0 });
+    const size_t stride = view.value("byteStride", sizeof(float) * 3);
+    const auto count = accessor.at("count").get<size_t>();
+
+    if (count > 0 && offset + stride * (count - 1) + sizeof(float) * 3 > buffer.size())
+    {
+      throw std::runtime_error("loadModelVertices::POSITION runs past its buffer");
+    }
+
+    vertices.reserve(vertices.size() + count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      float position[3];
+      std::memcpy(position, buffer.data() + offset + stride * i, sizeof(position));
+
+      vertices.emplace_back(matrix * glm::vec4(position[0], position[1], position[2], 1.0f));
+    }
+  }
+
+  void appendMesh(const Document& document, const size_t meshIndex, const glm::mat4& matrix,
+                  std::vector<glm::vec3>& vertices)
+  {
+    for (const auto& primitive : document.gltf.at("meshes").at(meshIndex).at("primitives"))
+    {
+      if (const auto& attributes = primitive.at("attributes"); attributes.contains("POSITION"))
+      {
+        appendPositions(document, attributes.at("POSITION").get<size_t>(), matrix, vertices);
+      }
+    }
+  }
+
+  void appendNode(const Document& document, const size_t nodeIndex, const glm::mat4& parent,
+                  std::vector<glm::vec3>& vertices)
+  {
+    const auto& node = document.gltf.at("nodes").at(nodeIndex);
+    const glm::mat4 matrix = parent * nodeMatrix(node);
+
+    if (node.contains("mesh"))
+    {
+      appendMesh(document, node.at("mesh").get<size_t>(), matrix, vertices);
+    }
+
+    for (const auto& child : node.value("children", nlohmann::json::array()))
+    {
+      appendNode(document, child.get<size_t>(), matrix, vertices);
+    }
+  }
+}
+
+std::vector<glm::vec3> loadModelVertices(const std::string& path)
+{
+  const std::filesystem::path filePath(path);
+
+  std::string extension = filePath.extension().string();
+  std::ranges::transform(extension, extension.begin(), [](const unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+
+  Document document;
+  if (extension == ".glb")
+  {
+    document = readGlb(filePath);
+  }
+  else if (extension == ".gltf")
+  {
+    document = readGltf(filePath);
+  }
+  else
+  {
+    throw std::runtime_error("loadModelVertices::Unsupported model format " + extension);
+  }
+
+  std::vector<glm::vec3> vertices;
+
+  // Without a scene there's no placement to apply, so each mesh is taken as it is.
+  const auto& scenes = document.gltf.value("scenes", nlohmann::json::array());
+  if (scenes.empty())
+  {
+    const size_t meshCount = document.gltf.contains("meshes") ? document.gltf.at("meshes").size() : 0;
+    for (size_t mesh = 0; mesh < meshCount; ++mesh)
+    {
+      appendMesh(document, mesh, glm::mat4(1.0f), vertices);
+    }
+
+    return vertices;
+  }
+
+  const auto& scene = scenes.at(document.gltf.value("scene", size_t{ 0 }));
+  for (const auto& node : scene.value("nodes", nlohmann::json::array()))
+  {
+    appendNode(document, node.get<size_t>(), glm::mat4(1.0f), vertices);
+  }
+
+  return vertices;
+}
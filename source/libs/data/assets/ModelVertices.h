@@ -0,0 +1,16 @@
+#ifndef MODELVERTICES_H
+#define MODELVERTICES_H
+
+#include <glm/vec3.hpp>
+#include <string>
+#include <vector>
+
+// The vertex positions of a glTF model (.glb, or .gltf with external buffers) in the model's own frame: every
+// mesh of the default scene, moved by its node transforms. Reads the file directly rather than through the
+// renderer, for shapes derived from a model's geometry (ConvexHullCollider) that only need the positions.
+// Throws std::runtime_error for an unreadable file or an unsupported format/attribute layout.
+[[nodiscard]] std::vector<glm::vec3> loadModelVertices(const std::string& path);
+
+
+
+#endif //MODELVERTICES_H
@@ -1,6 +1,7 @@
 #include "Object.h"
 #include "../ComponentRegistry.h"
 #include "components/Component.h"
+#include "components/RigidBody.h"
 #include "components/Transform.h"
 #include "components/Script.h"
 #include <nlohmann/json.hpp>
@@ -50,6 +51,11 @@ void Object::loadChildren(const nlohmann::json& childrenData)
 void Object::setParent(const std::shared_ptr<Object>& parent)
 {
   m_parent = parent;
+
+  if (m_manager)
+  {
+    m_manager->markStructureChanged();
+  }
 }
 
 std::shared_ptr<Object> Object::getParent() const
@@ -93,6 +99,17 @@ void Object::addComponent(const std::shared_ptr<Component>& component,
   else
   {
     m_components.emplace(component->getType(), component);
+
+    if (m_manager)
+    {
+      m_manager->markStructureChanged();
+    }
+
+    // The body's cached inertia was derived from the collider it had (or the lack of one).
+    if (component->getType() == ComponentType::collider)
+    {
+      invalidateBodyInertia();
+    }
   }
 
   if (setOwner)
@@ -110,6 +127,24 @@ void Object::removeComponent(const std::shared_ptr<Component>& component)
   else
   {
     m_components.erase(component->getType());
+
+    if (m_manager)
+    {
+      m_manager->markStructureChanged();
+    }
+
+    if (component->getType() == ComponentType::collider)
+    {
+      invalidateBodyInertia();
+    }
+  }
+}
+
+void Object::invalidateBodyInertia() const
+{
+  if (const auto rigidBody = getComponent<RigidBody>(ComponentType::rigidBody))
+  {
+    rigidBody->invalidateInverseInertia();
   }
 }
 
@@ -200,6 +235,16 @@ uuids::uuid Object::getUUID() const
   return m_uuid;
 }
 
+uint32_t Object::getNetworkID() const
+{
+  return m_networkID;
+}
+
+void Object::setNetworkID(const uint32_t networkID)
+{
+  m_networkID = networkID;
+}
+
 bool Object::isAncestorOf(const std::shared_ptr<Object>& object) const
 {
   auto current = getParent();
@@ -216,7 +261,7 @@ bool Object::isAncestorOf(const std::shared_ptr<Object>& object) const
   return false;
 }
 
-const std::unordered_map<ComponentType, std::shared_ptr<Component>>& Object::getComponents() const
+const std::map<ComponentType, std::shared_ptr<Component>>& Object::getComponents() const
 {
   return m_components;
 }
@@ -229,6 +274,7 @@ const std::vector<std::shared_ptr<Component>>& Object::getScripts() const
 void Object::pack(net::Message& message) const
 {
   message.writeString(uuids::to_string(m_uuid));
+  message.write(m_networkID);
 
   std::string cleanName = m_name;
   cleanName.erase(std::ranges::find(cleanName, '\0'), cleanName.end());
@@ -258,6 +304,10 @@ void Object::unpack(net::MessageReader& messageReader)
   // Symmetric with pack(): reconstructs this object from scratch, creating any missing components,
   // scripts, and child objects (so it works on a fresh, empty Object as well as an existing one).
   m_uuid = uuids::uuid::from_string(messageReader.readString()).value();
+
+  // Take the sender's network id over the one addObject gave this copy, so both ends name it the same.
+  m_manager->adoptNetworkID(shared_from_this(), messageReader.read<uint32_t>());
+
   m_name = messageReader.readString();
 
   const auto& registry = m_manager->getComponentRegistry();
@@ -3,8 +3,9 @@
 
 #include "ObjectManager.h"
 #include <nlohmann/json_fwd.hpp>
+#include <cstdint>
+#include <map>
 #include <vector>
-#include <unordered_map>
 #include <memory>
 #include <string>
 #include <uuid.h>
@@ -61,9 +62,18 @@ public:
 
   [[nodiscard]] uuids::uuid getUUID() const;
 
+  // The object's handle on the wire: a small id its ObjectManager hands out, which the snapshot and
+  // objectSpawned carry so the per-tick stream and edits can name the object in four bytes instead of a
+  // uuid string. Session-local - it isn't serialized, and 0 means "not in a manager yet". Set through
+  // ObjectManager (addObject / adoptNetworkID), which keeps its id -> object lookup in step.
+  [[nodiscard]] uint32_t getNetworkID() const;
+  void setNetworkID(uint32_t networkID);
+
   [[nodiscard]] bool isAncestorOf(const std::shared_ptr<Object>& object) const;
 
-  [[nodiscard]] const std::unordered_map<ComponentType, std::shared_ptr<Component>>& getComponents() const;
+  // Ordered by ComponentType, so every walk over an object's components (start, pack, serialize) visits
+  // them in the same order on every platform and every run.
+  [[nodiscard]] const std::map<ComponentType, std::shared_ptr<Component>>& getComponents() const;
 
   [[nodiscard]] const std::vector<std::shared_ptr<Component>>& getScripts() const;
 
@@ -72,7 +82,7 @@ public:
   void unpack(net::MessageReader& messageReader);
 
 private:
-  std::unordered_map<ComponentType, std::shared_ptr<Component>> m_components;
+  std::map<ComponentType, std::shared_ptr<Component>> m_components;
   std::vector<std::shared_ptr<Component>> m_scripts;
 
   ObjectManager* m_manager = nullptr;
@@ -83,10 +93,14 @@ private:
 
   uuids::uuid m_uuid;
 
+  uint32_t m_networkID = 0;
+
   std::string m_name;
 
   [[nodiscard]] std::shared_ptr<Component> getComponent(ComponentType type) const;
 
+  void invalidateBodyInertia() const;
+
   void loadFromJSON(const nlohmann::json& objectData);
 };
 
@@ -14,8 +14,7 @@ ObjectManager::ObjectManager(std::shared_ptr<ComponentRegistry> componentRegistr
       std::ranges::generate(seed_data, std::ref(rd));
       std::seed_seq seq(std::begin(seed_data), std::end(seed_data));
       return std::mt19937(seq);
-    }()),
-    m_uuidGenerator(m_rng)
+    }())
 {}
 
 std::shared_ptr<ComponentRegistry> ObjectManager::getComponentRegistry() const
@@ -25,16 +24,50 @@ std::shared_ptr<ComponentRegistry> ObjectManager::getComponentRegistry() const
 
 uuids::uuid ObjectManager::createUUID()
 {
-  return m_uuidGenerator();
+  return drawUUID(m_rng);
+}
+
+uuids::uuid ObjectManager::drawUUID(std::mt19937& engine)
+{
+  // Four draws, least significant byte first, whatever the host's byte order.
+  std::array<uuids::uuid::value_type, 16> bytes{};
+  for (size_t i = 0; i < bytes.size(); i += 4)
+  {
+    const uint32_t word = engine();
+    for (size_t byte = 0; byte < 4; ++byte)
+    {
+      bytes[i + byte] = static_cast<uuids::uuid::value_type>(word >> (byte * 8));
+    }
+  }
+
+  // Version 4 (0100xxxx), RFC 4122 variant (10xxxxxx).
+  bytes[6] = static_cast<uuids::uuid::value_type>((bytes[6] & 0x0F) | 0x40);
+  bytes[8] = static_cast<uuids::uuid::value_type>((bytes[8] & 0x3F) | 0x80);
+
+  return uuids::uuid(bytes);
+}
+
+void ObjectManager::seedUUIDs(const uint32_t seed)
+{
+  m_rng.seed(seed);
 }
 
 void ObjectManager::addObject(const std::shared_ptr<Object>& object)
 {
   object->setManager(this);
 
-  // Colliders aren't registered here: CollisionSystem discovers them by scanning the objects each tick.
+  // Colliders aren't registered here: CollisionSystem rescans the objects whenever the structure version moves.
 
   m_allObjects.push_back(object);
+  markStructureChanged();
+
+  // 0 is "unassigned", and after a wrap skip whatever is still live.
+  while (m_nextNetworkID == 0 || m_networkObjects.contains(m_nextNetworkID))
+  {
+    ++m_nextNetworkID;
+  }
+  object->setNetworkID(m_nextNetworkID);
+  m_networkObjects[m_nextNetworkID++] = object;
 
   if (object->getParent() == nullptr)
   {
@@ -137,14 +170,21 @@ nlohmann::json ObjectManager::serialize() const
   return data;
 }
 
-void ObjectManager::pack(net::Message& message) const
+void ObjectManager::pack(net::Message& message, const std::unordered_set<uint32_t>* roots) const
 {
+  const auto packed = [roots](const std::shared_ptr<Object>& object) {
+    return !roots || roots->contains(object->getNetworkID());
+  };
+
   // Mirrors serialize(): only the root objects are written, each packing its own subtree recursively.
-  message.write(static_cast<uint32_t>(m_objects.size()));
+  message.write(static_cast<uint32_t>(std::ranges::count_if(m_objects, packed)));
 
   for (const auto& object : m_objects)
   {
-    object->pack(message);
+    if (packed(object))
+    {
+      object->pack(message);
+    }
   }
 }
 
@@ -201,13 +241,20 @@ void ObjectManager::deleteObjectsMarkedForDeletion()
       }
     }
 
-    // (No CollisionSystem deregistration needed: it rescans the live objects each tick, so a removed
-    // object naturally drops out.)
+    // (No CollisionSystem deregistration needed: the structure version bump below makes it rescan the
+    // live objects, so a removed object naturally drops out.)
 
     std::erase(m_allObjects, object);
+
+    if (const auto networkObject = m_networkObjects.find(object->getNetworkID());
+        networkObject != m_networkObjects.end() && networkObject->second == object)
+    {
+      m_networkObjects.erase(networkObject);
+    }
   }
 
   m_objectsToRemove.clear();
+  markStructureChanged();
 }
 
 std::shared_ptr<Object> ObjectManager::getObjectByUUID(const uuids::uuid uuid) const
@@ -223,6 +270,27 @@ std::shared_ptr<Object> ObjectManager::getObjectByUUID(const uuids::uuid uuid) c
   return nullptr;
 }
 
+std::shared_ptr<Object> ObjectManager::getObjectByNetworkID(const uint32_t networkID) const
+{
+  const auto object = m_networkObjects.find(networkID);
+
+  return object != m_networkObjects.end() ? object->second : nullptr;
+}
+
+void ObjectManager::adoptNetworkID(const std::shared_ptr<Object>& object, const uint32_t networkID)
+{
+  if (const auto current = m_networkObjects.find(object->getNetworkID());
+      current != m_networkObjects.end() && current->second == object)
+  {
+    m_networkObjects.erase(current);
+  }
+
+  object->setNetworkID(networkID);
+  m_networkObjects[networkID] = object;
+
+  m_nextNetworkID = std::max(m_nextNetworkID, networkID + 1);
+}
+
 const std::vector<std::shared_ptr<Object>>& ObjectManager::getObjects() const
 {
   return m_objects;
@@ -2,8 +2,11 @@
 #define OBJECTMANAGER_H
 
 #include <nlohmann/json_fwd.hpp>
+#include <cstdint>
 #include <memory>
 #include <random>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <uuid.h>
 
@@ -23,6 +26,15 @@ public:
 
   [[nodiscard]] uuids::uuid createUUID();
 
+  // A version-4 uuid built from the engine's raw output. uuids::uuid_random_generator goes through a
+  // std::uniform_int_distribution, whose output the standard leaves to the library, so a seeded engine
+  // wouldn't mint the same uuids on every platform.
+  [[nodiscard]] static uuids::uuid drawUUID(std::mt19937& engine);
+
+  // Restart createUUID's generator from a fixed seed, so a deterministic run mints the same uuids for the
+  // same sequence of spawns (the default seeding is from std::random_device).
+  void seedUUIDs(uint32_t seed);
+
   void addObject(const std::shared_ptr<Object>& object);
 
   void addObjectToRoot(const std::shared_ptr<Object>& object);
@@ -46,7 +58,8 @@ public:
 
   [[nodiscard]] nlohmann::json serialize() const;
 
-  void pack(net::Message& message) const;
+  // roots, if given, keeps the packed tree to those root objects (by network id) and their subtrees.
+  void pack(net::Message& message, const std::unordered_set<uint32_t>* roots = nullptr) const;
 
   void unpack(net::MessageReader& messageReader);
 
@@ -56,10 +69,24 @@ public:
 
   [[nodiscard]] std::shared_ptr<Object> getObjectByUUID(uuids::uuid uuid) const;
 
+  // Constant-time lookup by the id addObject handed out (see Object::getNetworkID) - the replication path's
+  // way in, where getObjectByUUID would be a scan per entry.
+  [[nodiscard]] std::shared_ptr<Object> getObjectByNetworkID(uint32_t networkID) const;
+
+  // Re-key object under the id its sender gave it (Object::unpack), replacing the local one. Later local
+  // ids are handed out above it, so they don't land on ids the sender may still send.
+  void adoptNetworkID(const std::shared_ptr<Object>& object, uint32_t networkID);
+
   [[nodiscard]] const std::vector<std::shared_ptr<Object>>& getObjects() const;
 
   [[nodiscard]] const std::vector<std::shared_ptr<Object>>& getAllObjects() const;
 
+  // Bumped whenever the scene's shape changes: an object added or deleted, reparented, or a (non-script)
+  // component added or removed. Lets a system that caches a classification of the objects (e.g. the
+  // collision system's static/dynamic split) skip re-deriving it on ticks where nothing changed.
+  [[nodiscard]] uint64_t getStructureVersion() const { return m_structureVersion; }
+  void markStructureChanged() { ++m_structureVersion; }
+
 private:
   std::shared_ptr<ComponentRegistry> m_componentRegistry;
 
@@ -69,8 +96,12 @@ private:
 
   std::vector<std::shared_ptr<Object>> m_objectsToRemove;
 
+  std::unordered_map<uint32_t, std::shared_ptr<Object>> m_networkObjects;
+  uint32_t m_nextNetworkID = 1;
+
+  uint64_t m_structureVersion = 0;
+
   std::mt19937 m_rng;
-  uuids::uuid_random_generator m_uuidGenerator;
 
   // Recursively replace the serialized object's (and its children's) uuids with fresh ones.
   void reassignUUIDs(nlohmann::json& objectData);
@@ -24,7 +24,9 @@ enum class ComponentType {
   SubComponentType_sphereCollider,
   script,
   playerController,
-  camera // appended last: the packed value is the wire discriminator, so new types go at the end
+  camera, // appended last: the packed value is the wire discriminator, so new types go at the end
+  SubComponentType_compoundCollider,
+  SubComponentType_convexHullCollider
 };
 
 const std::unordered_map<ComponentType, std::string> componentTypeToString {
@@ -33,6 +35,8 @@ const std::unordered_map<ComponentType, std::string> componentTypeToString {
   {ComponentType::rigidBody, "Rigid Body"},
   {ComponentType::SubComponentType_boxCollider, "Box Collider"},
   {ComponentType::SubComponentType_sphereCollider, "Sphere Collider"},
+  {ComponentType::SubComponentType_compoundCollider, "Compound Collider"},
+  {ComponentType::SubComponentType_convexHullCollider, "Convex Hull Collider"},
   {ComponentType::lightRenderer, "Light Renderer"},
   {ComponentType::script, "Script"},
   {ComponentType::playerController, "Player Controller"},
@@ -41,12 +45,15 @@ const std::unordered_map<ComponentType, std::string> componentTypeToString {
 
 const std::unordered_map<ComponentType, ComponentType> subComponentTypeToParent {
   {ComponentType::SubComponentType_boxCollider, ComponentType::collider},
-  {ComponentType::SubComponentType_sphereCollider, ComponentType::collider}
+  {ComponentType::SubComponentType_sphereCollider, ComponentType::collider},
+  {ComponentType::SubComponentType_compoundCollider, ComponentType::collider},
+  {ComponentType::SubComponentType_convexHullCollider, ComponentType::collider}
 };
 
 // Maps a packed ComponentType (the discriminator each component writes first in pack()) back to its
 // ComponentRegistry factory key, so unpack() can reconstruct components from scratch. Colliders pack
-// their subtype, which is keyed by "Box"/"Sphere" (matching Object::loadFromJSON's registry lookup).
+// their subtype, which is keyed by "Box"/"Sphere"/"Compound"/"ConvexHull" (matching Object::loadFromJSON's
+// registry lookup).
 const std::unordered_map<ComponentType, std::string> componentTypeToRegistryKey {
   {ComponentType::transform, "Transform"},
   {ComponentType::modelRenderer, "ModelRenderer"},
@@ -54,6 +61,8 @@ const std::unordered_map<ComponentType, std::string> componentTypeToRegistryKey
   {ComponentType::lightRenderer, "LightRenderer"},
   {ComponentType::SubComponentType_boxCollider, "Box"},
   {ComponentType::SubComponentType_sphereCollider, "Sphere"},
+  {ComponentType::SubComponentType_compoundCollider, "Compound"},
+  {ComponentType::SubComponentType_convexHullCollider, "ConvexHull"},
   {ComponentType::script, "Script"},
   {ComponentType::playerController, "PlayerController"},
   {ComponentType::camera, "Camera"}
@@ -133,7 +142,9 @@ public:
 
   [[nodiscard]] ComponentType getSubType() const;
 
-  void setOwner(Object* owner);
+  // Virtual for a component that owns sub-components of its own (CompoundCollider's shapes), which must
+  // follow it onto its object.
+  virtual void setOwner(Object* owner);
   [[nodiscard]] Object* getOwner() const;
 
   [[nodiscard]] bool markedAsDeleted() const;
@@ -1,11 +1,17 @@
 #include "PlayerController.h"
+#include "Transform.h"
 #include <nlohmann/json.hpp>
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
 #include <Protocol.h>
+#include <algorithm>
+#include <cmath>
 
 PlayerController::PlayerController()
   : Component(ComponentType::playerController)
 {
   loadVariable(m_playerSlot);
+  loadVariable(m_moveSpeed);
 }
 
 int32_t PlayerController::getPlayerSlot() const
@@ -18,27 +24,83 @@ void PlayerController::setPlayerSlot(const int32_t playerSlot)
   m_playerSlot.set(playerSlot);
 }
 
+float PlayerController::getMoveSpeed() const
+{
+  return m_moveSpeed.get();
+}
+
+void PlayerController::setMoveSpeed(const float moveSpeed)
+{
+  m_moveSpeed.set(moveSpeed);
+}
+
+uint8_t PlayerController::getMoveButtons(const std::function<bool(int)>& isPressed)
+{
+  uint8_t moveButtons = 0;
+
+  for (size_t button = 0; button < moveKeys.size(); ++button)
+  {
+    if (isPressed(moveKeys[button]))
+    {
+      moveButtons |= static_cast<uint8_t>(1u << button);
+    }
+  }
+
+  return moveButtons;
+}
+
+uint8_t PlayerController::getMoveButtons(const std::vector<int>& pressedKeys)
+{
+  return getMoveButtons([&](const int key) {
+    return std::ranges::find(pressedKeys, key) != pressedKeys.end();
+  });
+}
+
+void PlayerController::move(Transform& transform, const uint8_t moveButtons, const float dt) const
+{
+  const float forwardInput = static_cast<float>((moveButtons & 1u) != 0) - static_cast<float>((moveButtons & 2u) != 0);
+  const float rightInput = static_cast<float>((moveButtons & 8u) != 0) - static_cast<float>((moveButtons & 4u) != 0);
+
+  if (m_moveSpeed.get() == 0.0f || (forwardInput == 0.0f && rightInput == 0.0f))
+  {
+    return;
+  }
+
+  // Facing is -Z turned by the yaw, as the camera sees it (RenderSystem::updateCamera).
+  const float yaw = glm::radians(transform.getLocalRotation().y);
+  const glm::vec3 forward(-std::sin(yaw), 0.0f, -std::cos(yaw));
+  const glm::vec3 right(std::cos(yaw), 0.0f, -std::sin(yaw));
+
+  // Normalized so a diagonal is no faster than a straight line.
+  const glm::vec3 direction = normalize(forward * forwardInput + right * rightInput);
+  transform.move(direction * (m_moveSpeed.get() * dt));
+}
+
 nlohmann::json PlayerController::serialize()
 {
   return {
     { "type", "PlayerController" },
-    { "playerSlot", m_playerSlot.getInitialValue() }
+    { "playerSlot", m_playerSlot.getInitialValue() },
+    { "moveSpeed", m_moveSpeed.getInitialValue() }
   };
 }
 
 void PlayerController::loadFromJSON(const nlohmann::json& componentData)
 {
-  // value(...) so an older scene without the field defaults cleanly (slot 0).
+  // value(...) so an older scene without the fields defaults cleanly (slot 0, no built-in movement).
   m_playerSlot.set(componentData.value("playerSlot", 0));
+  m_moveSpeed.set(componentData.value("moveSpeed", 0.0f));
 }
 
 void PlayerController::pack(net::Message& message) const
 {
   message.write(ComponentType::playerController);
   message.write(m_playerSlot.get());
+  message.write(m_moveSpeed.get());
 }
 
 void PlayerController::unpack(net::MessageReader& messageReader)
 {
   m_playerSlot.set(messageReader.read<int32_t>());
+  m_moveSpeed.set(messageReader.read<float>());
 }
@@ -2,19 +2,45 @@
 #define PLAYERCONTROLLER_H
 
 #include "Component.h"
+#include <array>
 #include <cstdint>
+#include <functional>
+#include <vector>
+
+class Transform;
 
 // Marks an object as owned by a player. playerSlot is the player index the object belongs to; the
 // server binds each connection to a slot (see ServerApp), so a script on this object reads that
 // player's input via ScriptBase.input. The slot is a ComponentVariable so a script/spawner can rebind it
 // at runtime and it resets on scene stop.
+//
+// A non-zero moveSpeed turns on the built-in movement: each tick, W/A/S/D walk the object on the
+// horizontal plane relative to its facing (yaw). Being a fixed function of the keys, it's what a client
+// can run ahead of the server for its own player (prediction); movement a script does can't be.
 class PlayerController final : public Component {
 public:
+  // The built-in movement's keys (GLFW key codes) in move-button bit order: forward, back, left, right.
+  static constexpr std::array<int, 4> moveKeys = { 87, 83, 65, 68 };
+
   PlayerController();
 
   [[nodiscard]] int32_t getPlayerSlot() const;
   void setPlayerSlot(int32_t playerSlot);
 
+  // Units per second; 0 leaves movement to scripts.
+  [[nodiscard]] float getMoveSpeed() const;
+  void setMoveSpeed(float moveSpeed);
+
+  // The move buttons (bit i: moveKeys[i]) for which isPressed(key) holds. The one place the bitmask is
+  // built, so the client's prediction and the server's fallback for a slot without move inputs agree.
+  [[nodiscard]] static uint8_t getMoveButtons(const std::function<bool(int)>& isPressed);
+
+  // The move buttons held among pressedKeys.
+  [[nodiscard]] static uint8_t getMoveButtons(const std::vector<int>& pressedKeys);
+
+  // One dt step of the built-in movement with moveButtons held, applied to transform's local position.
+  void move(Transform& transform, uint8_t moveButtons, float dt) const;
+
   [[nodiscard]] nlohmann::json serialize() override;
 
   void loadFromJSON(const nlohmann::json& componentData) override;
@@ -25,6 +51,7 @@ public:
 
 private:
   ComponentVariable<int32_t> m_playerSlot{0};
+  ComponentVariable<float> m_moveSpeed{0.0f};
 };
 
 
@@ -11,6 +11,7 @@ RigidBody::RigidBody()
   loadVariable(m_gravity);
   loadVariable(m_angularVelocity);
   loadVariable(m_mass);
+  loadVariable(m_continuousCollision);
 }
 
 void RigidBody::addPendingForce(const glm::vec3& force, const glm::vec3& position)
@@ -56,6 +57,52 @@ float RigidBody::getMass() const
 void RigidBody::setMass(const float mass)
 {
   m_mass.set(mass);
+  invalidateInverseInertia();
+}
+
+float RigidBody::getInverseMass()
+{
+  refreshInverseMass();
+
+  return m_inverseMass;
+}
+
+bool RigidBody::hasInverseInertia(const glm::vec3& scale)
+{
+  refreshInverseMass();
+
+  return m_inverseInertiaValid && m_inverseInertiaScale == scale;
+}
+
+const glm::mat3& RigidBody::getInverseInertia() const
+{
+  return m_inverseInertia;
+}
+
+void RigidBody::setInverseInertia(const glm::vec3& scale, const glm::mat3& inverseInertia)
+{
+  m_inverseInertia = inverseInertia;
+  m_inverseInertiaScale = scale;
+  m_inverseInertiaValid = true;
+}
+
+void RigidBody::invalidateInverseInertia()
+{
+  m_inverseInertiaValid = false;
+}
+
+void RigidBody::refreshInverseMass()
+{
+  const float mass = m_mass.get();
+  if (m_inverseMassValid && mass == m_inverseMassFor)
+  {
+    return;
+  }
+
+  m_inverseMassValid = true;
+  m_inverseMassFor = mass;
+  m_inverseMass = mass > 0.0f ? 1.0f / mass : 0.0f;
+  m_inverseInertiaValid = false;
 }
 
 float RigidBody::getFriction() const
@@ -88,6 +135,16 @@ void RigidBody::setDoGravity(const bool doGravity)
   m_doGravity.set(doGravity);
 }
 
+bool RigidBody::getContinuousCollision() const
+{
+  return m_continuousCollision.get();
+}
+
+void RigidBody::setContinuousCollision(const bool continuousCollision)
+{
+  m_continuousCollision.set(continuousCollision);
+}
+
 bool RigidBody::isFalling() const
 {
   return m_falling;
@@ -120,7 +177,8 @@ nlohmann::json RigidBody::serialize()
     { "friction", m_friction.getInitialValue() },
     { "doGravity", m_doGravity.getInitialValue() },
     { "gravity", m_gravity.getInitialValue() },
-    { "mass", m_mass.getInitialValue() }
+    { "mass", m_mass.getInitialValue() },
+    { "continuousCollision", m_continuousCollision.getInitialValue() }
   };
 
   return data;
@@ -146,6 +204,8 @@ void RigidBody::loadFromJSON(const nlohmann::json& componentData)
   m_doGravity.set(componentData.at("doGravity"));
   m_gravity.set(componentData.at("gravity"));
   m_mass.set(componentData.at("mass"));
+  // Added after the original format; default so older projects still load.
+  m_continuousCollision.set(componentData.value("continuousCollision", false));
 }
 
 void RigidBody::pack(net::Message& message) const
@@ -158,6 +218,7 @@ void RigidBody::pack(net::Message& message) const
   message.write(m_gravity.get());
   message.write(m_angularVelocity.get());
   message.write(m_mass.get());
+  message.write(m_continuousCollision.get());
 }
 
 void RigidBody::unpack(net::MessageReader& messageReader)
@@ -168,4 +229,5 @@ void RigidBody::unpack(net::MessageReader& messageReader)
   m_gravity.set(messageReader.read<float>());
   m_angularVelocity.set(messageReader.read<glm::vec3>());
   m_mass.set(messageReader.read<float>());
+  m_continuousCollision.set(messageReader.read<bool>());
 }
@@ -2,6 +2,7 @@
 #define RIGIDBODY_H
 
 #include "Component.h"
+#include <glm/mat3x3.hpp>
 #include <glm/vec3.hpp>
 #include <vector>
 
@@ -29,6 +30,17 @@ public:
   [[nodiscard]] float getMass() const;
   void setMass(float mass);
 
+  // 1 / mass (0 for a non-positive mass), recomputed only when the mass changes.
+  [[nodiscard]] float getInverseMass();
+
+  // PhysicsSystem's inverse inertia tensor, cached here so applying a force (gravity, friction, every
+  // collision impulse) doesn't rebuild and invert it. It holds while the mass and the world scale it was
+  // computed for do; the collider shape setters (and adding/removing a collider) invalidate it outright.
+  [[nodiscard]] bool hasInverseInertia(const glm::vec3& scale);
+  [[nodiscard]] const glm::mat3& getInverseInertia() const;
+  void setInverseInertia(const glm::vec3& scale, const glm::mat3& inverseInertia);
+  void invalidateInverseInertia();
+
   [[nodiscard]] float getFriction() const;
   void setFriction(float friction);
 
@@ -38,6 +50,13 @@ public:
   [[nodiscard]] bool getDoGravity() const;
   void setDoGravity(bool doGravity);
 
+  // Opt-in swept collision: PhysicsSystem clamps this body's per-tick move to the first time of impact
+  // along its velocity of any of its colliders (its object's or its children's), so a fast body can't step
+  // clean through thin geometry between ticks. The sweep is along the move only - rotation isn't swept. Off by
+  // default - the sweep costs extra narrow-phase work, so only flag bodies that actually need it.
+  [[nodiscard]] bool getContinuousCollision() const;
+  void setContinuousCollision(bool continuousCollision);
+
   [[nodiscard]] bool isFalling() const;
   void setFalling(bool falling);
 
@@ -59,11 +78,25 @@ private:
   ComponentVariable<float> m_gravity{-9.81f};
   ComponentVariable<glm::vec3> m_angularVelocity{glm::vec3(0)};
   ComponentVariable<float> m_mass{10.0f};
+  ComponentVariable<bool> m_continuousCollision{false};
 
   bool m_falling = true;
   bool m_nextFalling = true;
 
   std::vector<PendingForce> m_pendingForces;
+
+  // The mass the cached values were derived from.
+  bool m_inverseMassValid = false;
+  float m_inverseMassFor = 0.0f;
+  float m_inverseMass = 0.0f;
+
+  bool m_inverseInertiaValid = false;
+  glm::vec3 m_inverseInertiaScale{ 0.0f };
+  glm::mat3 m_inverseInertia{ 0.0f };
+
+  // setMass isn't the only way the mass changes: start()/stop() swap between the live and initial values,
+  // and load/unpack write it directly. So the cache compares against the current mass instead.
+  void refreshInverseMass();
 };
 
 
@@ -45,18 +45,22 @@ void BoxCollider::setPosition(const glm::vec3& position)
 {
   m_position.set(position);
   m_meshDirty = true;
+  m_boundsDirty = true;
 }
 
 void BoxCollider::setScale(const glm::vec3& scale)
 {
   m_scale.set(scale);
   m_meshDirty = true;
+  m_boundsDirty = true;
+  invalidateBodyInertia();
 }
 
 void BoxCollider::setRotation(const glm::vec3& rotation)
 {
   m_rotation.set(rotation);
   m_meshDirty = true;
+  m_boundsDirty = true;
 }
 
 nlohmann::json BoxCollider::serialize()
@@ -85,16 +89,15 @@ void BoxCollider::loadFromJSON(const nlohmann::json& componentData)
   const auto& rotation = componentData.at("rotation");
   const auto& scale = componentData.at("scale");
 
-  m_position.set(glm::vec3(position.at(0), position.at(1), position.at(2)));
-  m_rotation.set(glm::vec3(rotation.at(0), rotation.at(1), rotation.at(2)));
-  m_scale.set(glm::vec3(scale.at(0), scale.at(1), scale.at(2)));
+  // Through the setters, so the cached mesh and bounds and the body's inertia follow the new shape.
+  setPosition(glm::vec3(position.at(0), position.at(1), position.at(2)));
+  setRotation(glm::vec3(rotation.at(0), rotation.at(1), rotation.at(2)));
+  setScale(glm::vec3(scale.at(0), scale.at(1), scale.at(2)));
 
   // value() (not at()): projects saved before triggers/layers existed have no such key.
   m_isTrigger = componentData.value("isTrigger", false);
   m_layer = componentData.value("layer", 0u);
   m_mask = componentData.value("mask", 0xFFFFFFFFu);
-
-  m_meshDirty = true;
 }
 
 glm::vec3 BoxCollider::getPosition()
@@ -126,16 +129,7 @@ glm::vec3 BoxCollider::getRotation()
 
 glm::vec3 BoxCollider::findFurthestPoint(const glm::vec3& direction)
 {
-  updateTransformPointer();
-
-  if (const std::shared_ptr<Transform> transform = m_transform_ptr.lock())
-  {
-    if (m_meshDirty || m_currentTransformUpdateID != transform->getUpdateID())
-    {
-      generateTransformedMesh(transform);
-      m_meshDirty = false;
-    }
-  }
+  refreshTransformedMesh();
 
   float largestDot = std::numeric_limits<float>::lowest();
   glm::vec3 furthestVertex{ 0, 0, 0 };
@@ -152,6 +146,26 @@ glm::vec3 BoxCollider::findFurthestPoint(const glm::vec3& direction)
   return furthestVertex;
 }
 
+BoundsShape BoxCollider::getBoundsShape()
+{
+  const auto& worldMatrix = getWorldMatrix();
+  return { glm::vec3(worldMatrix[3]), glm::mat3(worldMatrix) };
+}
+
+const glm::mat4& BoxCollider::getWorldMatrix()
+{
+  refreshTransformedMesh();
+
+  return m_worldMatrix;
+}
+
+const glm::mat4& BoxCollider::getInverseWorldMatrix()
+{
+  refreshTransformedMesh();
+
+  return m_inverseWorldMatrix;
+}
+
 void BoxCollider::pack(net::Message& message) const
 {
   message.write(ComponentType::SubComponentType_boxCollider);
@@ -168,29 +182,44 @@ void BoxCollider::pack(net::Message& message) const
 void BoxCollider::unpack(net::MessageReader& messageReader)
 {
   m_renderCollider = messageReader.read<bool>();
-  m_position.set(messageReader.read<glm::vec3>());
-  m_scale.set(messageReader.read<glm::vec3>());
-  m_rotation.set(messageReader.read<glm::vec3>());
+  setPosition(messageReader.read<glm::vec3>());
+  setScale(messageReader.read<glm::vec3>());
+  setRotation(messageReader.read<glm::vec3>());
   m_isTrigger = messageReader.read<bool>();
   m_layer = messageReader.read<uint32_t>();
   m_mask = messageReader.read<uint32_t>();
 }
 
+void BoxCollider::refreshTransformedMesh()
+{
+  updateTransformPointer();
+
+  if (const std::shared_ptr<Transform> transform = m_transform_ptr.lock())
+  {
+    if (m_meshDirty || m_currentTransformUpdateID != transform->getUpdateID())
+    {
+      generateTransformedMesh(transform);
+      m_meshDirty = false;
+    }
+  }
+}
+
 void BoxCollider::generateTransformedMesh(const std::shared_ptr<Transform>& transform)
 {
   const auto rotation = transform->getRotation() + m_rotation.value();
   const auto scale = transform->getScale() * m_scale.value();
   const auto position = transform->getPosition() + m_position.value();
 
-  const auto transformationMatrix = translate(glm::mat4(1.0f), position)
+  m_worldMatrix = translate(glm::mat4(1.0f), position)
     * rotate(glm::mat4(1.0f), glm::radians(rotation.z), {0, 0, 1})
     * rotate(glm::mat4(1.0f), glm::radians(rotation.y), {0, 1, 0})
     * rotate(glm::mat4(1.0f), glm::radians(rotation.x), {1, 0, 0})
     * glm::scale(glm::mat4(1.0f), scale);
+  m_inverseWorldMatrix = inverse(m_worldMatrix);
 
   for (size_t i = 0; i < boxVertices.size(); ++i)
   {
-    const auto transformedVertex = transformationMatrix * glm::vec4(boxVertices[i], 1.0f);
+    const auto transformedVertex = m_worldMatrix * glm::vec4(boxVertices[i], 1.0f);
 
     m_transformedBoxVertices[i] = glm::vec3(transformedVertex);
   }
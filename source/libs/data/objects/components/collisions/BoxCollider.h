@@ -2,6 +2,7 @@
 #define BOXCOLLIDER_H
 
 #include "Collider.h"
+#include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 #include <array>
 
@@ -44,6 +45,14 @@ public:
 
   glm::vec3 findFurthestPoint(const glm::vec3& direction) override;
 
+  [[nodiscard]] BoundsShape getBoundsShape() override;
+
+  // The box's world matrix (maps the unit box [-1,1]^3 into world space) and its inverse. Cached alongside
+  // the transformed mesh, so they're rebuilt only when the transform's update id or the local offset
+  // changes - the scene queries read them instead of rebuilding the matrix per query.
+  [[nodiscard]] const glm::mat4& getWorldMatrix();
+  [[nodiscard]] const glm::mat4& getInverseWorldMatrix();
+
   void pack(net::Message& message) const override;
 
   void unpack(net::MessageReader& messageReader) override;
@@ -55,6 +64,9 @@ private:
 
   std::array<glm::vec3, boxVertices.size()> m_transformedBoxVertices{};
 
+  glm::mat4 m_worldMatrix{1.0f};
+  glm::mat4 m_inverseWorldMatrix{1.0f};
+
   uint8_t m_currentTransformUpdateID = 255;
 
   // Editing the collider's own offset doesn't bump the transform's update id, so force a mesh rebuild.
@@ -64,6 +76,9 @@ private:
   ComponentVariable<glm::vec3> m_scale = ComponentVariable(glm::vec3(1));
   ComponentVariable<glm::vec3> m_rotation = ComponentVariable(glm::vec3(0));
 
+  // Rebuild the mesh + matrices if the transform moved or the local offset was edited since the last build.
+  void refreshTransformedMesh();
+
   void generateTransformedMesh(const std::shared_ptr<Transform>& transform);
 
   void updateTransformPointer();
@@ -1,13 +1,44 @@
 #include "Collider.h"
+#include "../RigidBody.h"
 #include "../Transform.h"
 #include "../../Object.h"
+#include <glm/glm.hpp>
 #include <stdexcept>
 
 Collider::Collider(const ColliderType type, const ComponentType subType)
   : Component(ComponentType::collider, subType), m_colliderType(type)
 {}
 
+BoundingBox makeBoundingBox(const BoundsShape& shape)
+{
+  const glm::vec3 extent = abs(shape.axes[0]) + abs(shape.axes[1]) + abs(shape.axes[2]);
+
+  BoundingBox boundingBox;
+  boundingBox.minX = shape.center.x - extent.x;
+  boundingBox.maxX = shape.center.x + extent.x;
+  boundingBox.minY = shape.center.y - extent.y;
+  boundingBox.maxY = shape.center.y + extent.y;
+  boundingBox.minZ = shape.center.z - extent.z;
+  boundingBox.maxZ = shape.center.z + extent.z;
+  return boundingBox;
+}
+
 const BoundingBox& Collider::getBoundingBox()
+{
+  uint8_t transformUpdateID = 0;
+  if (!isBoundingBoxStale(transformUpdateID))
+  {
+    return m_boundingBox;
+  }
+
+  auto boundingBox = makeBoundingBox(getBoundsShape());
+  boundingBox.lastUpdateID = transformUpdateID;
+  setBoundingBox(boundingBox);
+
+  return m_boundingBox;
+}
+
+bool Collider::isBoundingBoxStale(uint8_t& transformUpdateID)
 {
   if (m_transform_ptr.expired())
   {
@@ -19,26 +50,15 @@ const BoundingBox& Collider::getBoundingBox()
     }
   }
 
-  const std::shared_ptr<Transform> transform = m_transform_ptr.lock();
-  const uint8_t transformUpdateID = transform->getUpdateID();
-
-  if (m_boundingBox.lastUpdateID == transformUpdateID)
-  {
-    return m_boundingBox;
-  }
-
-  m_boundingBox.lastUpdateID = transformUpdateID;
-
-  m_boundingBox.minX = findFurthestPoint({-1, 0, 0}).x;
-  m_boundingBox.maxX = findFurthestPoint({1, 0, 0}).x;
-
-  m_boundingBox.minY = findFurthestPoint({0, -1, 0}).y;
-  m_boundingBox.maxY = findFurthestPoint({0, 1, 0}).y;
+  transformUpdateID = m_transform_ptr.lock()->getUpdateID();
 
-  m_boundingBox.minZ = findFurthestPoint({0, 0, -1}).z;
-  m_boundingBox.maxZ = findFurthestPoint({0, 0, 1}).z;
+  return m_boundsDirty || m_boundingBox.lastUpdateID != transformUpdateID;
+}
 
-  return m_boundingBox;
+void Collider::setBoundingBox(const BoundingBox& boundingBox)
+{
+  m_boundingBox = boundingBox;
+  m_boundsDirty = false;
 }
 
 ColliderType Collider::getColliderType() const
@@ -76,3 +96,16 @@ void Collider::setMask(const uint32_t mask)
 {
   m_mask = mask;
 }
+
+void Collider::invalidateBodyInertia() const
+{
+  if (!m_owner)
+  {
+    return;
+  }
+
+  if (const auto rigidBody = m_owner->getComponent<RigidBody>(ComponentType::rigidBody))
+  {
+    rigidBody->invalidateInverseInertia();
+  }
+}
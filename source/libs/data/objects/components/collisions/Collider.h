@@ -2,6 +2,7 @@
 #define COLLIDER_H
 
 #include "../Component.h"
+#include <glm/mat3x3.hpp>
 #include <glm/vec3.hpp>
 #include <cstdint>
 #include <memory>
@@ -18,9 +19,22 @@ struct BoundingBox {
   float maxZ{};
 };
 
+// A collider's world-space extent as the image of the cube [-1,1]^3: a centre plus the columns of the linear
+// map (a box's scaled, rotated axes; radius * identity for a sphere). Its bounding box is the centre +/- the
+// per-axis sum of the columns' absolute components, which is all either bounding box path computes.
+struct BoundsShape {
+  glm::vec3 center{ 0.0f };
+  glm::mat3 axes{ 1.0f };
+};
+
+// The bounding box of shape (lastUpdateID left 0 for the caller to stamp).
+[[nodiscard]] BoundingBox makeBoundingBox(const BoundsShape& shape);
+
 enum class ColliderType {
   boxCollider,
-  sphereCollider
+  sphereCollider,
+  compoundCollider,
+  convexHullCollider
 };
 
 // Data-only: shape geometry (findFurthestPoint, bounding box). GJK/EPA narrow phase lives in CollisionSystem.
@@ -28,8 +42,19 @@ class Collider : public Component {
 public:
   explicit Collider(ColliderType type, ComponentType subType);
 
+  // Refreshes lazily (when the transform or the collider's own offset changed) and returns the cached box.
   const BoundingBox& getBoundingBox();
 
+  // The box as last computed, without the staleness check.
+  [[nodiscard]] const BoundingBox& getCachedBoundingBox() const { return m_boundingBox; }
+
+  // Batched refresh, for CollisionSystem, which recomputes every stale box in one pass instead of one
+  // getBoundingBox at a time: whether the cached box is stale (writing the transform update id the fresh
+  // one must be stamped with), the shape to compute it from, and storing the result.
+  [[nodiscard]] bool isBoundingBoxStale(uint8_t& transformUpdateID);
+  [[nodiscard]] virtual BoundsShape getBoundsShape() = 0;
+  void setBoundingBox(const BoundingBox& boundingBox);
+
   [[nodiscard]] ColliderType getColliderType() const;
 
   // A trigger still produces collision events but no physical response (no MTV correction, no
@@ -61,6 +86,12 @@ protected:
 
   BoundingBox m_boundingBox;
 
+  // Set by a subclass when its own offset/size changes (which doesn't bump the transform's update id).
+  bool m_boundsDirty = true;
+
+  // For a subclass whose size changed: the owning body's cached inertia was derived from the old shape.
+  void invalidateBodyInertia() const;
+
   bool m_isTrigger = false;
 
   uint32_t m_layer = 0;
@@ -0,0 +1,304 @@
+#include "CompoundCollider.h"
+#include "BoxCollider.h"
+#include "SphereCollider.h"
+#include "../Transform.h"
+#include "../../Object.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <nlohmann/json.hpp>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <Protocol.h>
+
+namespace {
+  // A fresh shape for a collider registry key ("Box"/"Sphere"); null for anything else (compounds don't nest).
+  std::shared_ptr<Collider> makeShape(const std::string& subType)
+  {
+    if (subType == "Box")
+    {
+      return std::make_shared<BoxCollider>();
+    }
+
+    if (subType == "Sphere")
+    {
+      return std::make_shared<SphereCollider>();
+    }
+
+    return nullptr;
+  }
+}
+
+CompoundCollider::CompoundCollider()
+  : Collider(ColliderType::compoundCollider, ComponentType::SubComponentType_compoundCollider)
+{}
+
+const std::vector<std::shared_ptr<Collider>>& CompoundCollider::getShapes() const
+{
+  return m_shapes;
+}
+
+std::shared_ptr<BoxCollider> CompoundCollider::addBox()
+{
+  auto box = std::make_shared<BoxCollider>();
+  addShape(box);
+
+  return box;
+}
+
+std::shared_ptr<SphereCollider> CompoundCollider::addSphere()
+{
+  auto sphere = std::make_shared<SphereCollider>();
+  addShape(sphere);
+
+  return sphere;
+}
+
+void CompoundCollider::removeShape(const size_t index)
+{
+  if (index >= m_shapes.size())
+  {
+    return;
+  }
+
+  m_shapes.erase(m_shapes.begin() + static_cast<std::ptrdiff_t>(index));
+  markShapesChanged();
+}
+
+void CompoundCollider::markShapesChanged()
+{
+  m_boundsDirty = true;
+  invalidateBodyInertia();
+}
+
+bool CompoundCollider::getRenderCollider() const
+{
+  return m_renderCollider;
+}
+
+void CompoundCollider::setRenderCollider(const bool renderCollider)
+{
+  m_renderCollider = renderCollider;
+}
+
+void CompoundCollider::setOwner(Object* owner)
+{
+  Collider::setOwner(owner);
+
+  for (const auto& shape : m_shapes)
+  {
+    shape->setOwner(owner);
+  }
+}
+
+void CompoundCollider::start()
+{
+  Collider::start();
+
+  for (const auto& shape : m_shapes)
+  {
+    shape->start();
+  }
+}
+
+void CompoundCollider::stop()
+{
+  Collider::stop();
+
+  for (const auto& shape : m_shapes)
+  {
+    shape->stop();
+  }
+}
+
+nlohmann::json CompoundCollider::serialize()
+{
+  // Each shape in its own serialized form, so a shape reads exactly like a standalone collider.
+  auto shapes = nlohmann::json::array();
+  for (const auto& shape : m_shapes)
+  {
+    shapes.push_back(shape->serialize());
+  }
+
+  const nlohmann::json data = {
+    { "type", "Collider" },
+    { "subType", "Compound" },
+    { "renderCollider", m_renderCollider },
+    { "isTrigger", m_isTrigger },
+    { "layer", m_layer },
+    { "mask", m_mask },
+    { "shapes", std::move(shapes) }
+  };
+
+  return data;
+}
+
+void CompoundCollider::loadFromJSON(const nlohmann::json& componentData)
+{
+  m_renderCollider = componentData.value("renderCollider", false);
+  m_isTrigger = componentData.value("isTrigger", false);
+  m_layer = componentData.value("layer", 0u);
+  m_mask = componentData.value("mask", 0xFFFFFFFFu);
+
+  m_shapes.clear();
+  for (const auto& shapeData : componentData.at("shapes"))
+  {
+    const std::string subType = shapeData.at("subType");
+
+    const auto shape = makeShape(subType);
+    if (!shape)
+    {
+      throw std::runtime_error("CompoundCollider::loadFromJSON::Unsupported shape " + subType);
+    }
+
+    shape->loadFromJSON(shapeData);
+    addShape(shape);
+  }
+
+  markShapesChanged();
+}
+
+glm::vec3 CompoundCollider::getPosition()
+{
+  uint8_t transformUpdateID = 0;
+  (void)isBoundingBoxStale(transformUpdateID);
+
+  return m_transform_ptr.lock()->getPosition();
+}
+
+glm::vec3 CompoundCollider::findFurthestPoint(const glm::vec3& direction)
+{
+  float largestDot = std::numeric_limits<float>::lowest();
+  glm::vec3 furthestPoint = getPosition();
+
+  for (const auto& shape : m_shapes)
+  {
+    const auto point = shape->findFurthestPoint(direction);
+
+    if (const float currentDot = dot(point, direction); currentDot > largestDot)
+    {
+      largestDot = currentDot;
+      furthestPoint = point;
+    }
+  }
+
+  return furthestPoint;
+}
+
+BoundsShape CompoundCollider::getBoundsShape()
+{
+  if (m_shapes.empty())
+  {
+    return { getPosition(), glm::mat3(0.0f) };
+  }
+
+  glm::vec3 min(std::numeric_limits<float>::max());
+  glm::vec3 max(std::numeric_limits<float>::lowest());
+
+  for (const auto& shape : m_shapes)
+  {
+    const auto box = makeBoundingBox(shape->getBoundsShape());
+
+    min = glm::min(min, glm::vec3(box.minX, box.minY, box.minZ));
+    max = glm::max(max, glm::vec3(box.maxX, box.maxY, box.maxZ));
+  }
+
+  // The union as a centre plus half-extent axes, which makeBoundingBox turns straight back into it.
+  const glm::vec3 halfExtent = 0.5f * (max - min);
+  glm::mat3 axes(0.0f);
+  axes[0][0] = halfExtent.x;
+  axes[1][1] = halfExtent.y;
+  axes[2][2] = halfExtent.z;
+
+  return { 0.5f * (min + max), axes };
+}
+
+void CompoundCollider::getLocalBounds(glm::vec3& min, glm::vec3& max) const
+{
+  min = glm::vec3(std::numeric_limits<float>::max());
+  max = glm::vec3(std::numeric_limits<float>::lowest());
+
+  for (const auto& shape : m_shapes)
+  {
+    glm::vec3 center(0.0f);
+    glm::vec3 extent(0.0f);
+
+    if (const auto sphere = std::dynamic_pointer_cast<SphereCollider>(shape))
+    {
+      center = sphere->getLocalPosition();
+      extent = glm::vec3(sphere->getLocalRadius());
+    }
+    else if (const auto box = std::dynamic_pointer_cast<BoxCollider>(shape))
+    {
+      // The unit box under the shape's own rotation and scale, as BoxCollider builds its world matrix.
+      const auto rotation = box->getLocalRotation();
+      const glm::mat3 axes = glm::mat3(rotate(glm::mat4(1.0f), glm::radians(rotation.z), { 0, 0, 1 })
+        * rotate(glm::mat4(1.0f), glm::radians(rotation.y), { 0, 1, 0 })
+        * rotate(glm::mat4(1.0f), glm::radians(rotation.x), { 1, 0, 0 })
+        * glm::scale(glm::mat4(1.0f), box->getLocalScale()));
+
+      center = box->getLocalPosition();
+      extent = abs(axes[0]) + abs(axes[1]) + abs(axes[2]);
+    }
+
+    min = glm::min(min, center - extent);
+    max = glm::max(max, center + extent);
+  }
+
+  if (m_shapes.empty())
+  {
+    min = glm::vec3(0.0f);
+    max = glm::vec3(0.0f);
+  }
+}
+
+void CompoundCollider::pack(net::Message& message) const
+{
+  message.write(ComponentType::SubComponentType_compoundCollider);
+
+  message.write(m_renderCollider);
+  message.write(m_isTrigger);
+  message.write(m_layer);
+  message.write(m_mask);
+
+  // Each shape packs its own discriminator first, which unpack reads back to recreate it.
+  message.write(static_cast<uint32_t>(m_shapes.size()));
+  for (const auto& shape : m_shapes)
+  {
+    shape->pack(message);
+  }
+}
+
+void CompoundCollider::unpack(net::MessageReader& messageReader)
+{
+  m_renderCollider = messageReader.read<bool>();
+  m_isTrigger = messageReader.read<bool>();
+  m_layer = messageReader.read<uint32_t>();
+  m_mask = messageReader.read<uint32_t>();
+
+  m_shapes.clear();
+
+  const auto shapeCount = messageReader.read<uint32_t>();
+  for (uint32_t i = 0; i < shapeCount; ++i)
+  {
+    const auto key = componentTypeToRegistryKey.find(messageReader.read<ComponentType>());
+
+    const auto shape = key != componentTypeToRegistryKey.end() ? makeShape(key->second) : nullptr;
+    if (!shape)
+    {
+      throw std::runtime_error("CompoundCollider::unpack::Unsupported shape");
+    }
+
+    shape->unpack(messageReader);
+    addShape(shape);
+  }
+
+  markShapesChanged();
+}
+
+void CompoundCollider::addShape(const std::shared_ptr<Collider>& shape)
+{
+  shape->setOwner(m_owner);
+  m_shapes.push_back(shape);
+  markShapesChanged();
+}
@@ -0,0 +1,75 @@
+#ifndef COMPOUNDCOLLIDER_H
+#define COMPOUNDCOLLIDER_H
+
+#include "Collider.h"
+#include <glm/vec3.hpp>
+#include <memory>
+#include <vector>
+
+class BoxCollider;
+class SphereCollider;
+
+// Several box/sphere shapes under one collider: a table's top and legs, a vehicle's hull and wheels. The
+// shapes are ordinary BoxCollider/SphereCollider instances owned here instead of by the object, so each
+// keeps its own local offset/rotation/size relative to the object's transform, while the object carries a
+// single collider slot, one broadphase entry (over the shapes' combined box) and one transform, uuid and
+// replication entry - rather than a child object per shape.
+//
+// Trigger, layer and mask are the compound's; the shapes' own copies are ignored. The narrow phase tests
+// shape against shape (a compound is not treated as the convex hull of its parts), and a contact reports
+// the deepest of the shape pairs that touch.
+class CompoundCollider final : public Collider {
+public:
+  CompoundCollider();
+
+  [[nodiscard]] const std::vector<std::shared_ptr<Collider>>& getShapes() const;
+
+  std::shared_ptr<BoxCollider> addBox();
+  std::shared_ptr<SphereCollider> addSphere();
+  void removeShape(size_t index);
+
+  // Call after editing a shape through its own setters: the combined box (and the body's inertia) is the
+  // compound's, which the shape's setters can't reach.
+  void markShapesChanged();
+
+  [[nodiscard]] bool getRenderCollider() const;
+  void setRenderCollider(bool renderCollider);
+
+  void setOwner(Object* owner) override;
+
+  void start() override;
+
+  void stop() override;
+
+  [[nodiscard]] nlohmann::json serialize() override;
+
+  void loadFromJSON(const nlohmann::json& componentData) override;
+
+  [[nodiscard]] glm::vec3 getPosition() override;
+
+  // The furthest point of any shape: the support of the shapes' convex hull. The collision system doesn't
+  // run GJK on it (it tests the shapes one by one); it's here for anything that only needs the hull.
+  glm::vec3 findFurthestPoint(const glm::vec3& direction) override;
+
+  // The union of the shapes' bounding boxes, as an axis-aligned bounds shape.
+  [[nodiscard]] BoundsShape getBoundsShape() override;
+
+  // The union of the shapes' boxes in the object's frame (unscaled, unrotated), for the inertia estimate.
+  // Zero-sized when there are no shapes.
+  void getLocalBounds(glm::vec3& min, glm::vec3& max) const;
+
+  void pack(net::Message& message) const override;
+
+  void unpack(net::MessageReader& messageReader) override;
+
+private:
+  bool m_renderCollider = false;
+
+  std::vector<std::shared_ptr<Collider>> m_shapes;
+
+  void addShape(const std::shared_ptr<Collider>& shape);
+};
+
+
+
+#endif //COMPOUNDCOLLIDER_H
@@ -0,0 +1,263 @@
+#include "ConvexHull.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+  using Edge = std::pair<uint32_t, uint32_t>;
+
+  // A hull triangle, wound counter-clockwise seen from outside, with its outward plane.
+  struct Face {
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    glm::vec3 normal;
+    float offset;
+  };
+
+  Face makeFace(const std::vector<glm::vec3>& points, const uint32_t a, const uint32_t b, const uint32_t c)
+  {
+    const glm::vec3 normal = cross(points[b] - points[a], points[c] - points[a]);
+    const float normalLength = length(normal);
+    const glm::vec3 unitNormal = normalLength > 0.0f ? normal / normalLength : glm::vec3(0.0f);
+
+    return { a, b, c, unitNormal, dot(unitNormal, points[a]) };
+  }
+
+  float heightAbove(const Face& face, const glm::vec3& point)
+  {
+    return dot(face.normal, point) - face.offset;
+  }
+
+  bool lexicographicLess(const glm::vec3& lhs, const glm::vec3& rhs)
+  {
+    if (lhs.x != rhs.x)
+    {
+      return lhs.x < rhs.x;
+    }
+
+    if (lhs.y != rhs.y)
+    {
+      return lhs.y < rhs.y;
+    }
+
+    return lhs.z < rhs.z;
+  }
+}
+
+std::shared_ptr<const ConvexHull> ConvexHull::build(const std::vector<glm::vec3>& input)
+{
+  // A mesh repeats each vertex once per face it's in.
+  std::vector<glm::vec3> points = input;
+  std::ranges::sort(points, lexicographicLess);
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+
+  if (points.size() < 4)
+  {
+    throw std::runtime_error("ConvexHull::build::Need at least four distinct points");
+  }
+
+  const auto count = static_cast<uint32_t>(points.size());
+
+  // Tolerances scale with the cloud, so a prop modelled in millimetres hulls the same as one in metres.
+  glm::vec3 min(std::numeric_limits<float>::max());
+  glm::vec3 max(std::numeric_limits<float>::lowest());
+  for (const auto& point : points)
+  {
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+  }
+
+  const glm::vec3 size = max - min;
+  const float epsilon = std::max({ size.x, size.y, size.z }) * 1e-5f;
+
+  const auto furthest = [&](const auto& distance) {
+    uint32_t best = 0;
+    float bestDistance = -1.0f;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      if (const float d = distance(points[i]); d > bestDistance)
+      {
+        best = i;
+        bestDistance = d;
+      }
+    }
+    return std::pair{ best, bestDistance };
+  };
+
+  // The starting tetrahedron: a point, the point furthest from it, the one furthest from the line through
+  // those two, and the one furthest from the plane through all three.
+  const glm::vec3 origin = points[0];
+
+  const auto [second, lineLength] = furthest([&](const glm::vec3& p) { return length(p - origin); });
+  if (lineLength <= epsilon)
+  {
+    throw std::runtime_error("ConvexHull::build::Points are all in one place");
+  }
+
+  const glm::vec3 axis = (points[second] - origin) / lineLength;
+  const auto [third, lineDistance] = furthest([&](const glm::vec3& p) { return length(cross(p - origin, axis)); });
+  if (lineDistance <= epsilon)
+  {
+    throw std::runtime_error("ConvexHull::build::Points are all on one line");
+  }
+
+  const glm::vec3 planeNormal = normalize(cross(points[second] - origin, points[third] - origin));
+  const auto [fourth, planeDistance] = furthest([&](const glm::vec3& p) { return std::abs(dot(p - origin, planeNormal)); });
+  if (planeDistance <= epsilon)
+  {
+    throw std::runtime_error("ConvexHull::build::Points are all on one plane");
+  }
+
+  const glm::vec3 inside = 0.25f * (origin + points[second] + points[third] + points[fourth]);
+
+  std::vector<Face> faces;
+  const std::array<std::array<uint32_t, 3>, 4> seedFaces {{
+    { 0, second, third }, { 0, fourth, second }, { 0, third, fourth }, { second, fourth, third }
+  }};
+  for (const auto& [a, b, c] : seedFaces)
+  {
+    // Each face outward, whichever side of the first three the fourth point fell.
+    const Face face = makeFace(points, a, b, c);
+    faces.push_back(heightAbove(face, inside) > 0.0f ? makeFace(points, a, c, b) : face);
+  }
+
+  // Grow the hull a point at a time: the faces a point is above are replaced by a fan from the point to the
+  // rim of that region, the edges of the removed faces whose reverse (the face across them) stays.
+  std::vector<Edge> removedEdges;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const glm::vec3& point = points[i];
+    const auto isVisible = [&](const Face& face) { return heightAbove(face, point) > epsilon; };
+
+    removedEdges.clear();
+    for (const auto& face : faces)
+    {
+      if (isVisible(face))
+      {
+        removedEdges.emplace_back(face.a, face.b);
+        removedEdges.emplace_back(face.b, face.c);
+        removedEdges.emplace_back(face.c, face.a);
+      }
+    }
+
+    if (removedEdges.empty())
+    {
+      continue; // inside (or on) the hull so far, which includes the four starting points
+    }
+
+    std::ranges::sort(removedEdges);
+    std::erase_if(faces, isVisible);
+
+    for (const auto& [a, b] : removedEdges)
+    {
+      if (!std::ranges::binary_search(removedEdges, Edge{ b, a }))
+      {
+        faces.push_back(makeFace(points, a, b, i));
+      }
+    }
+  }
+
+  // Keep only the points the faces use, and the edge graph between them.
+  const std::shared_ptr<ConvexHull> hull(new ConvexHull());
+
+  std::vector<uint32_t> remap(count, std::numeric_limits<uint32_t>::max());
+  const auto vertexFor = [&](const uint32_t point) {
+    if (remap[point] == std::numeric_limits<uint32_t>::max())
+    {
+      remap[point] = static_cast<uint32_t>(hull->m_vertices.size());
+      hull->m_vertices.push_back(points[point]);
+    }
+    return remap[point];
+  };
+
+  std::vector<Edge> edges;
+  edges.reserve(faces.size() * 6);
+  hull->m_planes.reserve(faces.size());
+
+  for (const auto& face : faces)
+  {
+    const uint32_t a = vertexFor(face.a);
+    const uint32_t b = vertexFor(face.b);
+    const uint32_t c = vertexFor(face.c);
+
+    edges.insert(edges.end(), { { a, b }, { b, a }, { b, c }, { c, b }, { c, a }, { a, c } });
+    hull->m_planes.emplace_back(face.normal, face.offset);
+  }
+
+  std::ranges::sort(edges);
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  hull->m_neighbourBegin.assign(hull->m_vertices.size() + 1, 0);
+  hull->m_neighbours.reserve(edges.size());
+  for (const auto& [from, to] : edges)
+  {
+    ++hull->m_neighbourBegin[from + 1];
+    hull->m_neighbours.push_back(to);
+  }
+
+  for (size_t i = 1; i < hull->m_neighbourBegin.size(); ++i)
+  {
+    hull->m_neighbourBegin[i] += hull->m_neighbourBegin[i - 1];
+  }
+
+  hull->m_min = glm::vec3(std::numeric_limits<float>::max());
+  hull->m_max = glm::vec3(std::numeric_limits<float>::lowest());
+  for (const auto& vertex : hull->m_vertices)
+  {
+    hull->m_min = glm::min(hull->m_min, vertex);
+    hull->m_max = glm::max(hull->m_max, vertex);
+  }
+
+  return hull;
+}
+
+const std::vector<glm::vec3>& ConvexHull::getVertices() const
+{
+  return m_vertices;
+}
+
+const std::vector<glm::vec4>& ConvexHull::getPlanes() const
+{
+  return m_planes;
+}
+
+glm::vec3 ConvexHull::getMin() const
+{
+  return m_min;
+}
+
+glm::vec3 ConvexHull::getMax() const
+{
+  return m_max;
+}
+
+uint32_t ConvexHull::findFurthestVertex(const glm::vec3& direction, const uint32_t start) const
+{
+  uint32_t current = start < m_vertices.size() ? start : 0;
+  float currentDot = dot(m_vertices[current], direction);
+
+  // Move to the best neighbour until none is strictly further; strictly, so a face or edge square to
+  // direction (all its vertices equally far) can't send it round in circles.
+  for (uint32_t vertex = std::numeric_limits<uint32_t>::max(); vertex != current;)
+  {
+    vertex = current;
+
+    for (uint32_t i = m_neighbourBegin[vertex]; i < m_neighbourBegin[vertex + 1]; ++i)
+    {
+      const uint32_t neighbour = m_neighbours[i];
+
+      if (const float neighbourDot = dot(m_vertices[neighbour], direction); neighbourDot > currentDot)
+      {
+        currentDot = neighbourDot;
+        current = neighbour;
+      }
+    }
+  }
+
+  return current;
+}
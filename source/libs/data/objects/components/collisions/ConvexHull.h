@@ -0,0 +1,51 @@
+#ifndef CONVEXHULL_H
+#define CONVEXHULL_H
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// A convex polyhedron in its own (object-local) frame: the hull vertices of a point cloud, the hull's edge
+// graph and its face planes, all computed once when it's built. Immutable, so a ConvexHullCollider and the
+// scene queries' snapshots of it share one instance, and a rebuild swaps the pointer instead of editing it.
+class ConvexHull {
+public:
+  // The hull of points (a model's vertices, say; duplicates and interior points are dropped). Throws
+  // std::runtime_error when they span no volume: fewer than four points that aren't all on one plane.
+  [[nodiscard]] static std::shared_ptr<const ConvexHull> build(const std::vector<glm::vec3>& points);
+
+  [[nodiscard]] const std::vector<glm::vec3>& getVertices() const;
+
+  // Outward face planes: xyz is the unit normal, w the offset (dot(normal, p) == w on the face).
+  [[nodiscard]] const std::vector<glm::vec4>& getPlanes() const;
+
+  // The vertices' bounding box.
+  [[nodiscard]] glm::vec3 getMin() const;
+  [[nodiscard]] glm::vec3 getMax() const;
+
+  // The index of the vertex furthest along direction, found by hill-climbing the edge graph from vertex
+  // start. On a convex polyhedron a vertex none of whose neighbours is further is the furthest of all, so
+  // starting from the previous answer for the same body (which barely moves between queries) takes a step
+  // or two rather than a scan of every vertex. Any start gives the right answer; only the cost differs.
+  [[nodiscard]] uint32_t findFurthestVertex(const glm::vec3& direction, uint32_t start = 0) const;
+
+private:
+  ConvexHull() = default;
+
+  std::vector<glm::vec3> m_vertices;
+
+  // Vertex i's neighbours are m_neighbours[m_neighbourBegin[i]] up to m_neighbours[m_neighbourBegin[i + 1]].
+  std::vector<uint32_t> m_neighbourBegin;
+  std::vector<uint32_t> m_neighbours;
+
+  std::vector<glm::vec4> m_planes;
+
+  glm::vec3 m_min{ 0.0f };
+  glm::vec3 m_max{ 0.0f };
+};
+
+
+
+#endif //CONVEXHULL_H
@@ -0,0 +1,228 @@
+#include "ConvexHullCollider.h"
+#include "BoxCollider.h"
+#include "ConvexHull.h"
+#include "../Transform.h"
+#include "../../Object.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <Protocol.h>
+
+namespace {
+  // What a collider that hasn't been built from anything is: the unit box, shared by all of them.
+  const std::shared_ptr<const ConvexHull>& unitBoxHull()
+  {
+    static const auto hull = ConvexHull::build({ boxVertices.begin(), boxVertices.end() });
+    return hull;
+  }
+}
+
+ConvexHullCollider::ConvexHullCollider()
+  : Collider(ColliderType::convexHullCollider, ComponentType::SubComponentType_convexHullCollider),
+    m_hull(unitBoxHull())
+{}
+
+const std::shared_ptr<const ConvexHull>& ConvexHullCollider::getHull() const
+{
+  return m_hull;
+}
+
+void ConvexHullCollider::setPoints(const std::vector<glm::vec3>& points)
+{
+  setHull(ConvexHull::build(points));
+}
+
+uuids::uuid ConvexHullCollider::getModelUUID() const
+{
+  return m_modelUUID;
+}
+
+void ConvexHullCollider::setModelUUID(const uuids::uuid& modelUUID)
+{
+  m_modelUUID = modelUUID;
+}
+
+bool ConvexHullCollider::getRenderCollider() const
+{
+  return m_renderCollider;
+}
+
+void ConvexHullCollider::setRenderCollider(const bool renderCollider)
+{
+  m_renderCollider = renderCollider;
+}
+
+nlohmann::json ConvexHullCollider::serialize()
+{
+  auto points = nlohmann::json::array();
+  for (const auto& vertex : m_hull->getVertices())
+  {
+    points.push_back({ vertex.x, vertex.y, vertex.z });
+  }
+
+  const nlohmann::json data = {
+    { "type", "Collider" },
+    { "subType", "ConvexHull" },
+    { "renderCollider", m_renderCollider },
+    { "modelUUID", m_modelUUID.is_nil() ? "" : uuids::to_string(m_modelUUID) },
+    { "points", std::move(points) },
+    { "isTrigger", m_isTrigger },
+    { "layer", m_layer },
+    { "mask", m_mask }
+  };
+
+  return data;
+}
+
+void ConvexHullCollider::loadFromJSON(const nlohmann::json& componentData)
+{
+  std::vector<glm::vec3> points;
+  for (const auto& point : componentData.at("points"))
+  {
+    points.emplace_back(point.at(0), point.at(1), point.at(2));
+  }
+
+  setPoints(points);
+
+  m_modelUUID = uuids::uuid::from_string(componentData.value("modelUUID", std::string())).value_or(uuids::uuid());
+  m_renderCollider = componentData.value("renderCollider", false);
+  m_isTrigger = componentData.value("isTrigger", false);
+  m_layer = componentData.value("layer", 0u);
+  m_mask = componentData.value("mask", 0xFFFFFFFFu);
+}
+
+glm::vec3 ConvexHullCollider::getPosition()
+{
+  updateTransformPointer();
+
+  return m_transform_ptr.lock()->getPosition();
+}
+
+glm::vec3 ConvexHullCollider::findFurthestPoint(const glm::vec3& direction)
+{
+  const auto& worldMatrix = getWorldMatrix();
+
+  // dot(M v, d) == dot(v, M^T d): climb in the hull's own frame, then map the winner out.
+  const glm::vec3 localDirection = transpose(glm::mat3(worldMatrix)) * direction;
+
+  const uint32_t vertex = m_hull->findFurthestVertex(localDirection, m_lastSupport.load(std::memory_order_relaxed));
+  m_lastSupport.store(vertex, std::memory_order_relaxed);
+
+  return glm::vec3(worldMatrix * glm::vec4(m_hull->getVertices()[vertex], 1.0f));
+}
+
+BoundsShape ConvexHullCollider::getBoundsShape()
+{
+  const auto& worldMatrix = getWorldMatrix();
+
+  const glm::vec3 center = 0.5f * (m_hull->getMin() + m_hull->getMax());
+  const glm::vec3 halfExtent = 0.5f * (m_hull->getMax() - m_hull->getMin());
+
+  return { glm::vec3(worldMatrix * glm::vec4(center, 1.0f)),
+           glm::mat3(worldMatrix) * glm::mat3(glm::scale(glm::mat4(1.0f), halfExtent)) };
+}
+
+const glm::mat4& ConvexHullCollider::getWorldMatrix()
+{
+  refreshWorldMatrix();
+
+  return m_worldMatrix;
+}
+
+const glm::mat4& ConvexHullCollider::getInverseWorldMatrix()
+{
+  refreshWorldMatrix();
+
+  return m_inverseWorldMatrix;
+}
+
+void ConvexHullCollider::pack(net::Message& message) const
+{
+  message.write(ComponentType::SubComponentType_convexHullCollider);
+
+  message.write(m_renderCollider);
+  message.write(m_modelUUID);
+
+  const auto& vertices = m_hull->getVertices();
+  message.write(static_cast<uint32_t>(vertices.size()));
+  for (const auto& vertex : vertices)
+  {
+    message.write(vertex);
+  }
+
+  message.write(m_isTrigger);
+  message.write(m_layer);
+  message.write(m_mask);
+}
+
+void ConvexHullCollider::unpack(net::MessageReader& messageReader)
+{
+  m_renderCollider = messageReader.read<bool>();
+  m_modelUUID = messageReader.read<uuids::uuid>();
+
+  // Checked against what's left before reserving, so a corrupt count can't ask for gigabytes.
+  const auto count = messageReader.read<uint32_t>();
+  if (count > messageReader.remaining() / sizeof(glm::vec3))
+  {
+    throw std::runtime_error("ConvexHullCollider::unpack::Point count exceeds the message");
+  }
+
+  std::vector<glm::vec3> points;
+  points.reserve(count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    points.push_back(messageReader.read<glm::vec3>());
+  }
+
+  setPoints(points);
+
+  m_isTrigger = messageReader.read<bool>();
+  m_layer = messageReader.read<uint32_t>();
+  m_mask = messageReader.read<uint32_t>();
+}
+
+void ConvexHullCollider::setHull(std::shared_ptr<const ConvexHull> hull)
+{
+  m_hull = std::move(hull);
+  m_lastSupport.store(0, std::memory_order_relaxed);
+
+  m_boundsDirty = true;
+  invalidateBodyInertia();
+}
+
+void ConvexHullCollider::refreshWorldMatrix()
+{
+  updateTransformPointer();
+
+  if (const std::shared_ptr<Transform> transform = m_transform_ptr.lock();
+      transform && (m_matrixDirty || m_currentTransformUpdateID != transform->getUpdateID()))
+  {
+    const auto rotation = transform->getRotation();
+
+    m_worldMatrix = translate(glm::mat4(1.0f), transform->getPosition())
+      * rotate(glm::mat4(1.0f), glm::radians(rotation.z), {0, 0, 1})
+      * rotate(glm::mat4(1.0f), glm::radians(rotation.y), {0, 1, 0})
+      * rotate(glm::mat4(1.0f), glm::radians(rotation.x), {1, 0, 0})
+      * glm::scale(glm::mat4(1.0f), transform->getScale());
+    m_inverseWorldMatrix = inverse(m_worldMatrix);
+
+    m_currentTransformUpdateID = transform->getUpdateID();
+    m_matrixDirty = false;
+  }
+}
+
+void ConvexHullCollider::updateTransformPointer()
+{
+  if (m_transform_ptr.expired())
+  {
+    m_transform_ptr = m_owner->getComponent<Transform>(ComponentType::transform);
+
+    if (m_transform_ptr.expired())
+    {
+      throw std::runtime_error("ConvexHullCollider::updateTransformPointer::Missing transform component");
+    }
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef CONVEXHULLCOLLIDER_H
+#define CONVEXHULLCOLLIDER_H
+
+#include "Collider.h"
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <uuid.h>
+
+class ConvexHull;
+
+// The convex hull of a point cloud (typically a model's vertices) in the object's frame, following the
+// object's transform like a box does: one GJK/EPA shape for a prop that would otherwise take a cluster of
+// boxes. The hull vertices themselves are stored, serialized and replicated, so nothing reads the model at
+// runtime. Until it's built from something it is the unit box, the same shape a new BoxCollider has.
+class ConvexHullCollider final : public Collider {
+public:
+  ConvexHullCollider();
+
+  [[nodiscard]] const std::shared_ptr<const ConvexHull>& getHull() const;
+
+  // Rebuild from points in the object's frame (see loadModelVertices). Throws std::runtime_error, keeping
+  // the current hull, when the points span no volume.
+  void setPoints(const std::vector<glm::vec3>& points);
+
+  // The model the hull was last built from, for the editor to show and rebuild from. Informational only.
+  [[nodiscard]] uuids::uuid getModelUUID() const;
+  void setModelUUID(const uuids::uuid& modelUUID);
+
+  [[nodiscard]] bool getRenderCollider() const;
+  void setRenderCollider(bool renderCollider);
+
+  [[nodiscard]] nlohmann::json serialize() override;
+
+  void loadFromJSON(const nlohmann::json& componentData) override;
+
+  [[nodiscard]] glm::vec3 getPosition() override;
+
+  // Hill-climbs the hull's edge graph from the vertex the previous call returned: successive support queries
+  // on a body (GJK's iterations, then the next pass's) point in nearly the same direction, so this is a
+  // step or two instead of a scan of every vertex.
+  glm::vec3 findFurthestPoint(const glm::vec3& direction) override;
+
+  // The hull's local bounding box under the world matrix.
+  [[nodiscard]] BoundsShape getBoundsShape() override;
+
+  // Object-local to world (the transform's translation, rotation and scale) and back. Cached per transform
+  // update id, like BoxCollider's, for the support function and the scene queries.
+  [[nodiscard]] const glm::mat4& getWorldMatrix();
+  [[nodiscard]] const glm::mat4& getInverseWorldMatrix();
+
+  void pack(net::Message& message) const override;
+
+  void unpack(net::MessageReader& messageReader) override;
+
+private:
+  bool m_renderCollider = false;
+
+  std::shared_ptr<const ConvexHull> m_hull;
+
+  uuids::uuid m_modelUUID;
+
+  // Where the next support query starts climbing. Pairs sharing this collider may query it from different
+  // workers at once; any start gives the right vertex, so relaxed loads/stores are all it needs.
+  std::atomic<uint32_t> m_lastSupport = 0;
+
+  glm::mat4 m_worldMatrix{ 1.0f };
+  glm::mat4 m_inverseWorldMatrix{ 1.0f };
+
+  uint8_t m_currentTransformUpdateID = 255;
+
+  // Forces the first build, whatever update id the transform starts at.
+  bool m_matrixDirty = true;
+
+  void setHull(std::shared_ptr<const ConvexHull> hull);
+
+  void refreshWorldMatrix();
+
+  void updateTransformPointer();
+};
+
+
+
+#endif //CONVEXHULLCOLLIDER_H
@@ -33,6 +33,8 @@ float SphereCollider::getLocalRadius() const
 void SphereCollider::setRadius(const float radius)
 {
   m_radius.set(radius);
+  m_boundsDirty = true;
+  invalidateBodyInertia();
 }
 
 glm::vec3 SphereCollider::getLocalPosition() const
@@ -43,6 +45,7 @@ glm::vec3 SphereCollider::getLocalPosition() const
 void SphereCollider::setPosition(const glm::vec3& position)
 {
   m_position.set(position);
+  m_boundsDirty = true;
 }
 
 bool SphereCollider::getRenderCollider() const
@@ -75,10 +78,11 @@ nlohmann::json SphereCollider::serialize()
 
 void SphereCollider::loadFromJSON(const nlohmann::json& componentData)
 {
+  // Through the setters, so the cached bounds and the body's inertia follow the new shape.
   const auto& position = componentData.at("position");
-  m_position.set(glm::vec3(position.at(0), position.at(1), position.at(2)));
+  setPosition(glm::vec3(position.at(0), position.at(1), position.at(2)));
 
-  m_radius.set(componentData.at("radius"));
+  setRadius(componentData.at("radius"));
   m_renderCollider = componentData.at("renderCollider");
 
   // value() (not at()): projects saved before triggers/layers existed have no such key.
@@ -108,6 +112,15 @@ glm::vec3 SphereCollider::findFurthestPoint(const glm::vec3& direction)
   return { 0, 0, 0 };
 }
 
+BoundsShape SphereCollider::getBoundsShape()
+{
+  updateTransformPointer();
+
+  const std::shared_ptr<Transform> transform = m_transform_ptr.lock();
+
+  return { transform->getPosition() + m_position.value(), glm::mat3(getScaledRadius(transform)) };
+}
+
 void SphereCollider::pack(net::Message& message) const
 {
   message.write(ComponentType::SubComponentType_sphereCollider);
@@ -123,8 +136,8 @@ void SphereCollider::pack(net::Message& message) const
 void SphereCollider::unpack(net::MessageReader& messageReader)
 {
   m_renderCollider = messageReader.read<bool>();
-  m_position.set(messageReader.read<glm::vec3>());
-  m_radius.set(messageReader.read<float>());
+  setPosition(messageReader.read<glm::vec3>());
+  setRadius(messageReader.read<float>());
   m_isTrigger = messageReader.read<bool>();
   m_layer = messageReader.read<uint32_t>();
   m_mask = messageReader.read<uint32_t>();
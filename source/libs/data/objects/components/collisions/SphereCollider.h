@@ -29,6 +29,8 @@ public:
 
   glm::vec3 findFurthestPoint(const glm::vec3& direction) override;
 
+  [[nodiscard]] BoundsShape getBoundsShape() override;
+
   void pack(net::Message& message) const override;
 
   void unpack(net::MessageReader& messageReader) override;
@@ -0,0 +1,37 @@
+#ifndef SCENEQUERYTYPES_H
+#define SCENEQUERYTYPES_H
+
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <uuid.h>
+
+// Plain query/result records for the batched scene queries. They live in data (not sim) because both
+// sides of the BindingContext injection need them: SceneQueries (sim) implements the batches, and the World
+// bindings (scripting, which can't link sim) fill the queries in and read the results back.
+
+struct RaycastQuery {
+  glm::vec3 origin{ 0.0f };
+  glm::vec3 direction{ 0.0f, 0.0f, 1.0f };
+  float maxDistance = 0.0f;
+  uint32_t layerMask = 0xFFFFFFFFu;
+  uuids::uuid ignoreObject; // nil = ignore nothing
+};
+
+struct RaycastResult {
+  bool hit = false;
+  uuids::uuid object;
+  glm::vec3 point{ 0.0f };
+  glm::vec3 normal{ 0.0f };
+  float distance = 0.0f;
+};
+
+struct OverlapSphereQuery {
+  glm::vec3 center{ 0.0f };
+  float radius = 0.0f;
+  uint32_t layerMask = 0xFFFFFFFFu;
+  uuids::uuid ignoreObject; // nil = ignore nothing
+};
+
+
+
+#endif //SCENEQUERYTYPES_H
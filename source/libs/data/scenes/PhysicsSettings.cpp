@@ -0,0 +1,138 @@
+#include "PhysicsSettings.h"
+#include <nlohmann/json.hpp>
+#include <Protocol.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  // Whether the replication bounds and precision describe a usable grid; fromJSON/unpack keep the defaults
+  // otherwise, so TransformQuantizer never divides by a zero or negative range.
+  bool validReplicationGrid(const glm::vec3& min, const glm::vec3& max, const float precision)
+  {
+    return max.x > min.x && max.y > min.y && max.z > min.z
+      && std::isfinite(min.x) && std::isfinite(min.y) && std::isfinite(min.z)
+      && std::isfinite(max.x) && std::isfinite(max.y) && std::isfinite(max.z)
+      && std::isfinite(precision) && precision > 0.0f;
+  }
+}
+
+PhysicsSettings::PhysicsSettings()
+{
+  layerMatrix.fill(0xFFFFFFFFu);
+}
+
+bool PhysicsSettings::layersInteract(const uint32_t a, const uint32_t b) const
+{
+  if (a >= layerCount || b >= layerCount)
+  {
+    return false;
+  }
+
+  return (layerMatrix[a] & (1u << b)) != 0u;
+}
+
+void PhysicsSettings::setLayersInteract(const uint32_t a, const uint32_t b, const bool interact)
+{
+  if (a >= layerCount || b >= layerCount)
+  {
+    return;
+  }
+
+  if (interact)
+  {
+    layerMatrix[a] |= 1u << b;
+    layerMatrix[b] |= 1u << a;
+  }
+  else
+  {
+    layerMatrix[a] &= ~(1u << b);
+    layerMatrix[b] &= ~(1u << a);
+  }
+}
+
+nlohmann::json PhysicsSettings::serialize() const
+{
+  const nlohmann::json data = {
+    { "layerMatrix", layerMatrix },
+    { "substeps", substeps },
+    { "replicationBoundsMin", { replicationBoundsMin.x, replicationBoundsMin.y, replicationBoundsMin.z } },
+    { "replicationBoundsMax", { replicationBoundsMax.x, replicationBoundsMax.y, replicationBoundsMax.z } },
+    { "positionPrecision", positionPrecision }
+  };
+
+  return data;
+}
+
+PhysicsSettings PhysicsSettings::fromJSON(const nlohmann::json& data)
+{
+  PhysicsSettings settings;
+
+  if (data.contains("layerMatrix"))
+  {
+    const auto& rows = data.at("layerMatrix");
+    for (uint32_t layer = 0; layer < layerCount && layer < rows.size(); ++layer)
+    {
+      settings.layerMatrix[layer] = rows.at(layer).get<uint32_t>();
+    }
+
+    for (uint32_t a = 0; a < layerCount; ++a)
+    {
+      for (uint32_t b = a + 1; b < layerCount; ++b)
+      {
+        settings.setLayersInteract(a, b, settings.layersInteract(a, b) && settings.layersInteract(b, a));
+      }
+    }
+  }
+
+  settings.substeps = std::clamp(data.value("substeps", 1u), 1u, maxSubsteps);
+
+  const auto readVec3 = [&data](const char* key, const glm::vec3& fallback) {
+    if (!data.contains(key))
+    {
+      return fallback;
+    }
+
+    const auto& value = data.at(key);
+    return glm::vec3(value.at(0), value.at(1), value.at(2));
+  };
+
+  const auto boundsMin = readVec3("replicationBoundsMin", settings.replicationBoundsMin);
+  const auto boundsMax = readVec3("replicationBoundsMax", settings.replicationBoundsMax);
+  const float precision = data.value("positionPrecision", settings.positionPrecision);
+  if (validReplicationGrid(boundsMin, boundsMax, precision))
+  {
+    settings.replicationBoundsMin = boundsMin;
+    settings.replicationBoundsMax = boundsMax;
+    settings.positionPrecision = precision;
+  }
+
+  return settings;
+}
+
+void PhysicsSettings::pack(net::Message& message) const
+{
+  message.write(layerMatrix);
+  message.write(substeps);
+  message.write(replicationBoundsMin);
+  message.write(replicationBoundsMax);
+  message.write(positionPrecision);
+}
+
+PhysicsSettings PhysicsSettings::unpack(net::MessageReader& messageReader)
+{
+  PhysicsSettings settings;
+  settings.layerMatrix = messageReader.read<std::array<uint32_t, layerCount>>();
+  settings.substeps = std::clamp(messageReader.read<uint32_t>(), 1u, maxSubsteps);
+
+  const auto boundsMin = messageReader.read<glm::vec3>();
+  const auto boundsMax = messageReader.read<glm::vec3>();
+  const auto precision = messageReader.read<float>();
+  if (validReplicationGrid(boundsMin, boundsMax, precision))
+  {
+    settings.replicationBoundsMin = boundsMin;
+    settings.replicationBoundsMax = boundsMax;
+    settings.positionPrecision = precision;
+  }
+
+  return settings;
+}
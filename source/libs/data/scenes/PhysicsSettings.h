@@ -0,0 +1,56 @@
+#ifndef PHYSICSSETTINGS_H
+#define PHYSICSSETTINGS_H
+
+#include <nlohmann/json_fwd.hpp>
+#include <glm/vec3.hpp>
+#include <array>
+#include <cstdint>
+
+namespace net {
+  class Message;
+  class MessageReader;
+}
+
+// Per-scene physics configuration, owned by SceneAsset and applied by the server to its systems when the
+// scene becomes active. Saved with the scene; every field is optional in the JSON so older projects load
+// with the defaults.
+struct PhysicsSettings {
+  static constexpr uint32_t layerCount = 32;
+
+  // Which collision layers interact: bit b of row a set = layer a collides with layer b. Kept symmetric by
+  // setLayersInteract (the broadphase only ever reads one side). Defaults to every pair. A collider's own
+  // mask still applies on top of it; the matrix is what lets the broadphase skip whole layers unvisited.
+  std::array<uint32_t, layerCount> layerMatrix;
+
+  // Physics + collision steps per script tick, each covering 1/substeps of the tick. More substeps buy
+  // accuracy for fast or stacked bodies without running the (managed) scripts any more often.
+  static constexpr uint32_t maxSubsteps = 16;
+  uint32_t substeps = 1;
+
+  // The state delta's fixed-point positions (TransformQuantizer): local positions inside these bounds go
+  // out as whole steps of positionPrecision metres from boundsMin, rounded, so each is off by at most half
+  // a step. Anything outside falls back to full floats. Tighter bounds or a coarser precision take fewer
+  // bytes per axis (the fewest that hold the step count, 1-4).
+  glm::vec3 replicationBoundsMin{ -1024.0f };
+  glm::vec3 replicationBoundsMax{ 1024.0f };
+  float positionPrecision = 0.001f;
+
+  PhysicsSettings();
+
+  [[nodiscard]] bool layersInteract(uint32_t a, uint32_t b) const;
+  void setLayersInteract(uint32_t a, uint32_t b, bool interact);
+
+  [[nodiscard]] nlohmann::json serialize() const;
+
+  // Missing keys keep their defaults; a non-symmetric matrix is made symmetric (a pair interacts only if
+  // both rows say so), substeps is clamped to [1, maxSubsteps], and replication bounds that are empty on
+  // any axis or a precision that isn't positive fall back to the defaults.
+  [[nodiscard]] static PhysicsSettings fromJSON(const nlohmann::json& data);
+
+  void pack(net::Message& message) const;
+  [[nodiscard]] static PhysicsSettings unpack(net::MessageReader& messageReader);
+};
+
+
+
+#endif //PHYSICSSETTINGS_H
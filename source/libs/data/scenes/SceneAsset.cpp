@@ -44,18 +44,20 @@ nlohmann::json SceneAsset::serialize() const
   nlohmann::json data = {
     { "name", m_name },
     { "objects", serializedObjects["objects"] },
+    { "physics", m_physicsSettings.serialize() },
     { "uuid", uuids::to_string(m_uuid) }
   };
 
   return data;
 }
 
-void SceneAsset::pack(net::Message& message) const
+void SceneAsset::pack(net::Message& message, const std::unordered_set<uint32_t>* roots) const
 {
   message.writeString(uuids::to_string(m_uuid));
   message.writeString(m_name);
+  m_physicsSettings.pack(message);
 
-  m_objectManager->pack(message);
+  m_objectManager->pack(message, roots);
 }
 
 std::shared_ptr<SceneAsset> SceneAsset::unpack(net::MessageReader& messageReader,
@@ -65,6 +67,7 @@ std::shared_ptr<SceneAsset> SceneAsset::unpack(net::MessageReader& messageReader
   const auto name = messageReader.readString();
 
   auto scene = std::make_shared<SceneAsset>(uuid, name, componentRegistry);
+  scene->m_physicsSettings = PhysicsSettings::unpack(messageReader);
   scene->m_objectManager->unpack(messageReader);
 
   return scene;
@@ -84,3 +87,13 @@ std::string SceneAsset::getName() const
 {
   return m_name;
 }
+
+const PhysicsSettings& SceneAsset::getPhysicsSettings() const
+{
+  return m_physicsSettings;
+}
+
+void SceneAsset::setPhysicsSettings(const PhysicsSettings& physicsSettings)
+{
+  m_physicsSettings = physicsSettings;
+}
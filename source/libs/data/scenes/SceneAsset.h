@@ -1,9 +1,12 @@
 #ifndef SCENEASSET_H
 #define SCENEASSET_H
 
+#include "PhysicsSettings.h"
 #include <nlohmann/json_fwd.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <uuid.h>
 
 namespace net {
@@ -31,9 +34,10 @@ public:
 
   [[nodiscard]] nlohmann::json serialize() const;
 
-  void pack(net::Message& message) const;
+  // roots, if given, limits the packed object tree to those roots (see ObjectManager::pack).
+  void pack(net::Message& message, const std::unordered_set<uint32_t>* roots = nullptr) const;
 
-  // Reconstructs a scene (uuid + name + object tree) from a packed snapshot. A static factory because
+  // Reconstructs a scene (uuid + name + physics settings + object tree) from a packed snapshot. A static factory because
   // the uuid/name lead the packed data and are needed to construct the SceneAsset itself.
   [[nodiscard]] static std::shared_ptr<SceneAsset> unpack(net::MessageReader& messageReader,
                                                           const std::shared_ptr<ComponentRegistry>& componentRegistry);
@@ -44,12 +48,17 @@ public:
 
   [[nodiscard]] std::string getName() const;
 
+  [[nodiscard]] const PhysicsSettings& getPhysicsSettings() const;
+  void setPhysicsSettings(const PhysicsSettings& physicsSettings);
+
 private:
   uuids::uuid m_uuid;
 
   std::string m_name;
 
   std::shared_ptr<ObjectManager> m_objectManager;
+
+  PhysicsSettings m_physicsSettings;
 };
 
 
@@ -1,14 +1,25 @@
 #include "ColliderEditor.h"
+#include "../AssetDragDrop.h"
 #include "../ComponentEditor.h"
 #include "../GuiComponents.h"
+#include <assets/AssetRegistry.h>
+#include <assets/ModelVertices.h>
+#include <objects/Object.h>
+#include <objects/components/ModelRenderer.h>
 #include <objects/components/collisions/Collider.h>
 #include <objects/components/collisions/BoxCollider.h>
+#include <objects/components/collisions/CompoundCollider.h>
+#include <objects/components/collisions/ConvexHull.h>
+#include <objects/components/collisions/ConvexHullCollider.h>
 #include <objects/components/collisions/SphereCollider.h>
 #include <glm/vec3.hpp>
 #include <imgui.h>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <filesystem>
+#include <iostream>
 #include <memory>
 #include <string>
 
@@ -147,12 +158,35 @@ namespace {
 
     return edited;
   }
+
+  // Rebuild hull from a registered model's vertices. An unknown record or an unreadable or flat model leaves
+  // the hull as it was (reported on stderr). Returns whether it was rebuilt.
+  bool buildHullFromModel(ConvexHullCollider& hull, const AssetRegistry* registry, const uuids::uuid& modelUUID)
+  {
+    const auto* record = registry ? registry->getByUUID(modelUUID) : nullptr;
+    if (!record || record->type != AssetType::Model)
+    {
+      return false;
+    }
+
+    try
+    {
+      hull.setPoints(loadModelVertices(record->path));
+      hull.setModelUUID(modelUUID);
+      return true;
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << "[ColliderEditor] Could not build a hull from " << record->path << ": " << e.what() << std::endl;
+      return false;
+    }
+  }
 }
 
-void registerColliderEditors(ComponentEditor& componentEditor)
+void registerColliderEditors(ComponentEditor& componentEditor, const AssetRegistry* assetRegistry)
 {
-  // Keyed by display name (componentTypeToString), since both colliders share a component type and
-  // differ only by subType.
+  // Keyed by display name (componentTypeToString), since the colliders share a component type and differ
+  // only by subType.
   componentEditor.registerHandler("Box Collider", [](const std::shared_ptr<Component>& component) -> bool {
     const auto box = std::dynamic_pointer_cast<BoxCollider>(component);
     if (!box)
@@ -255,6 +289,193 @@ void registerColliderEditors(ComponentEditor& componentEditor)
     return edited;
   });
 
+  componentEditor.registerHandler("Compound Collider", [](const std::shared_ptr<Component>& component) -> bool {
+    const auto compound = std::dynamic_pointer_cast<CompoundCollider>(component);
+    if (!compound)
+    {
+      return false;
+    }
+
+    bool edited = false;
+
+    if (ComponentEditor::displayHeader(component))
+    {
+      bool renderCollider = compound->getRenderCollider();
+      if (gc::accentCheckbox("Render Collider", &renderCollider))
+      {
+        compound->setRenderCollider(renderCollider);
+        edited = true;
+      }
+
+      bool isTrigger = compound->isTrigger();
+      if (gc::accentCheckbox("Is Trigger", &isTrigger))
+      {
+        compound->setIsTrigger(isTrigger);
+        edited = true;
+      }
+
+      edited |= colliderLayerMaskEditor(compound);
+
+      // One block per shape, with the same fields as the standalone collider. A shape's setters only
+      // reach the shape, so every edit is followed by markShapesChanged() for the compound's bounds.
+      ImGui::PushID("CompoundCollider");
+      const auto& shapes = compound->getShapes();
+      for (size_t i = 0; i < shapes.size(); ++i)
+      {
+        ImGui::PushID(static_cast<int>(i));
+        ImGui::Separator();
+
+        bool shapeEdited = false;
+
+        if (const auto box = std::dynamic_pointer_cast<BoxCollider>(shapes[i]))
+        {
+          gc::sectionLabel("Box");
+
+          glm::vec3 position = box->getLocalPosition();
+          glm::vec3 rotation = box->getLocalRotation();
+          glm::vec3 scale = box->getLocalScale();
+
+          if (gc::xyzGuiBoxed("Position", &position.x, &position.y, &position.z))
+          {
+            box->setPosition(position);
+            shapeEdited = true;
+          }
+
+          if (gc::xyzGuiBoxed("Rotation", &rotation.x, &rotation.y, &rotation.z))
+          {
+            box->setRotation(rotation);
+            shapeEdited = true;
+          }
+
+          if (gc::xyzGuiBoxed("Scale", &scale.x, &scale.y, &scale.z))
+          {
+            box->setScale(scale);
+            shapeEdited = true;
+          }
+        }
+        else if (const auto sphere = std::dynamic_pointer_cast<SphereCollider>(shapes[i]))
+        {
+          gc::sectionLabel("Sphere");
+
+          float radius = sphere->getLocalRadius();
+          if (gc::labeledDrag("Radius", &radius))
+          {
+            sphere->setRadius(radius);
+            shapeEdited = true;
+          }
+
+          glm::vec3 position = sphere->getLocalPosition();
+          if (gc::xyzGuiBoxed("Position", &position.x, &position.y, &position.z))
+          {
+            sphere->setPosition(position);
+            shapeEdited = true;
+          }
+        }
+
+        if (shapeEdited)
+        {
+          compound->markShapesChanged();
+          edited = true;
+        }
+
+        // Removing invalidates the shape list; stop drawing it for this frame.
+        const bool remove = ImGui::Button("Remove Shape", ImVec2(ImGui::GetContentRegionAvail().x, 0.0f));
+        ImGui::PopID();
+
+        if (remove)
+        {
+          compound->removeShape(i);
+          edited = true;
+          break;
+        }
+      }
+
+      ImGui::Separator();
+
+      if (gc::dashedButton("Add Box", gc::SecIcon::collider, 30.0f))
+      {
+        (void)compound->addBox();
+        edited = true;
+      }
+      if (gc::dashedButton("Add Sphere", gc::SecIcon::sphere, 30.0f))
+      {
+        (void)compound->addSphere();
+        edited = true;
+      }
+      ImGui::PopID();
+    }
+
+    return edited;
+  });
+
+  componentEditor.registerHandler("Convex Hull Collider",
+    [registry = assetRegistry](const std::shared_ptr<Component>& component) -> bool {
+    const auto hull = std::dynamic_pointer_cast<ConvexHullCollider>(component);
+    if (!hull)
+    {
+      return false;
+    }
+
+    bool edited = false;
+
+    if (ComponentEditor::displayHeader(component))
+    {
+      bool renderCollider = hull->getRenderCollider();
+      if (gc::accentCheckbox("Render Collider", &renderCollider))
+      {
+        hull->setRenderCollider(renderCollider);
+        edited = true;
+      }
+
+      bool isTrigger = hull->isTrigger();
+      if (gc::accentCheckbox("Is Trigger", &isTrigger))
+      {
+        hull->setIsTrigger(isTrigger);
+        edited = true;
+      }
+
+      edited |= colliderLayerMaskEditor(hull);
+
+      ImGui::Spacing();
+
+      // The model the hull was built from; drop another model asset here to rebuild from it.
+      std::string name = "Unit box";
+      if (const auto* record = registry ? registry->getByUUID(hull->getModelUUID()) : nullptr)
+      {
+        name = std::filesystem::path(record->path).filename().string();
+      }
+
+      gc::assetRefRow("hullModelSlot", "Hull Model", name.c_str(), 0, gc::SecIcon::model, theme::modelPurple);
+
+      if (ImGui::BeginDragDropTarget())
+      {
+        if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(assetDragDrop::model))
+        {
+          const std::string uuidStr(static_cast<const char*>(payload->Data), payload->DataSize);
+          if (const auto dropped = uuids::uuid::from_string(uuidStr))
+          {
+            edited |= buildHullFromModel(*hull, registry, dropped.value());
+          }
+        }
+
+        ImGui::EndDragDropTarget();
+      }
+
+      // The usual case: the hull of what the object draws.
+      const auto owner = hull->getOwner();
+      const auto modelRenderer = owner ? owner->getComponent<ModelRenderer>(ComponentType::modelRenderer) : nullptr;
+      if (modelRenderer && !modelRenderer->getModelUUID().is_nil() &&
+          gc::dashedButton("Build from Model Renderer", gc::SecIcon::model, 30.0f))
+      {
+        edited |= buildHullFromModel(*hull, registry, modelRenderer->getModelUUID());
+      }
+
+      ImGui::TextColored(theme::t2, "%zu hull vertices", hull->getHull()->getVertices().size());
+    }
+
+    return edited;
+  });
+
   // The collider debug gizmo (the shape drawn with the objectHighlight pipeline when "Render Collider"
   // is on) is handled by ECS3DRender's RenderSystem via GpuAssetCache::getColliderGizmo.
 }
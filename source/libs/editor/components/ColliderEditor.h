@@ -2,8 +2,11 @@
 #define COLLIDEREDITOR_H
 
 class ComponentEditor;
+class AssetRegistry;
 
-void registerColliderEditors(ComponentEditor& componentEditor);
+// The registry resolves a convex hull's model asset to a file to build it from. May be null, in which case
+// hulls can't be rebuilt from the editor.
+void registerColliderEditors(ComponentEditor& componentEditor, const AssetRegistry* assetRegistry = nullptr);
 
 
 
@@ -56,6 +56,14 @@ void registerPlayerControllerEditor(ComponentEditor& componentEditor)
         playerController->setPlayerSlot(std::max(slot, 0));
         edited = true;
       }
+
+      // The built-in WASD movement's speed; 0 leaves movement to the object's scripts.
+      float moveSpeed = playerController->getMoveSpeed();
+      if (gc::labeledDrag("Move Speed", &moveSpeed, 0.1f))
+      {
+        playerController->setMoveSpeed(std::max(moveSpeed, 0.0f));
+        edited = true;
+      }
     }
 
     return edited;
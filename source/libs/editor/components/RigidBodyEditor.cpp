@@ -23,6 +23,7 @@ void registerRigidBodyEditor(ComponentEditor& componentEditor)
       float gravity = rigidBody->getGravity();
       float friction = rigidBody->getFriction();
       float mass = rigidBody->getMass();
+      bool continuousCollision = rigidBody->getContinuousCollision();
 
       if (gc::accentCheckbox("Do Gravity", &doGravity))
       {
@@ -47,6 +48,12 @@ void registerRigidBodyEditor(ComponentEditor& componentEditor)
         rigidBody->setMass(mass);
         edited = true;
       }
+
+      if (gc::accentCheckbox("Continuous Collision", &continuousCollision))
+      {
+        rigidBody->setContinuousCollision(continuousCollision);
+        edited = true;
+      }
     }
 
     return edited;
@@ -0,0 +1,290 @@
+#include "JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  // One parallelFor call. Lives on its caller's stack, which waits for remaining to hit 0 - so decrementing
+  // remaining must be the last thing a chunk does with it.
+  struct Batch {
+    const std::function<void(size_t, size_t)>* body = nullptr;
+    std::atomic<size_t> remaining{ 0 };
+    std::atomic<int64_t> busyNanoseconds{ 0 };
+
+    std::mutex errorMutex;
+    std::exception_ptr error;
+  };
+
+  struct Chunk {
+    Batch* batch = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Chunk> chunks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> s_queues;
+  std::vector<std::thread> s_workers;
+
+  // Idle workers sleep on s_wake until chunks are queued (s_queued > 0) or the pool stops. s_queued is
+  // raised under s_wakeMutex after the chunks are in the deques and dropped as they're taken, so it can
+  // briefly dip below zero when a chunk is taken before its batch was counted - hence signed.
+  std::mutex s_wakeMutex;
+  std::condition_variable s_wake;
+  std::atomic<int64_t> s_queued{ 0 };
+  bool s_stopping = false;
+
+  // Whether this thread is running a chunk right now - a worker, or a caller helping out its own loop. A
+  // parallelFor from in there runs inline: fanning out would have the chunk wait on busy workers.
+  thread_local bool s_inChunk = false;
+
+  std::mutex s_statsMutex;
+  std::map<std::string, JobSystem::JobStats> s_stats;
+
+  bool popFront(WorkerQueue& queue, Chunk& chunk)
+  {
+    std::lock_guard lock(queue.mutex);
+    if (queue.chunks.empty())
+    {
+      return false;
+    }
+
+    chunk = queue.chunks.front();
+    queue.chunks.pop_front();
+    return true;
+  }
+
+  bool popBack(WorkerQueue& queue, Chunk& chunk)
+  {
+    std::lock_guard lock(queue.mutex);
+    if (queue.chunks.empty())
+    {
+      return false;
+    }
+
+    chunk = queue.chunks.back();
+    queue.chunks.pop_back();
+    return true;
+  }
+
+  // Own deque first (back: the chunk dealt most recently, still warm), then steal the oldest chunk of the
+  // others', starting past our own so thieves spread out instead of all hitting deque 0.
+  bool takeChunk(const int32_t self, Chunk& chunk)
+  {
+    const auto queueCount = static_cast<int32_t>(s_queues.size());
+
+    bool taken = self >= 0 && popBack(*s_queues[self], chunk);
+
+    for (int32_t offset = 1; !taken && offset <= queueCount; ++offset)
+    {
+      const int32_t victim = (std::max(self, 0) + offset) % queueCount;
+      taken = victim != self && popFront(*s_queues[victim], chunk);
+    }
+
+    if (taken)
+    {
+      s_queued.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    return taken;
+  }
+
+  void runChunk(const Chunk& chunk)
+  {
+    Batch& batch = *chunk.batch;
+    const auto start = Clock::now();
+    const bool nested = std::exchange(s_inChunk, true);
+
+    try
+    {
+      (*batch.body)(chunk.begin, chunk.end);
+    }
+    catch (...)
+    {
+      std::lock_guard lock(batch.errorMutex);
+      if (!batch.error)
+      {
+        batch.error = std::current_exception();
+      }
+    }
+    s_inChunk = nested;
+
+    batch.busyNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count(),
+                                    std::memory_order_relaxed);
+    batch.remaining.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  void workerLoop(const int32_t index)
+  {
+    while (true)
+    {
+      Chunk chunk;
+      if (takeChunk(index, chunk))
+      {
+        runChunk(chunk);
+        continue;
+      }
+
+      std::unique_lock lock(s_wakeMutex);
+      s_wake.wait(lock, [] { return s_stopping || s_queued.load(std::memory_order_relaxed) > 0; });
+
+      if (s_stopping)
+      {
+        return;
+      }
+    }
+  }
+
+  void recordStats(const std::string& name, const size_t chunks, const Clock::duration wall, const double busySeconds)
+  {
+    std::lock_guard lock(s_statsMutex);
+
+    auto& stats = s_stats[name];
+    stats.name = name;
+    ++stats.runs;
+    stats.chunks += chunks;
+    stats.wallSeconds += std::chrono::duration<double>(wall).count();
+    stats.busySeconds += busySeconds;
+  }
+}
+
+void JobSystem::configure(uint32_t workerCount)
+{
+  shutdown();
+
+  if (workerCount == 0)
+  {
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+  }
+
+  {
+    std::lock_guard lock(s_wakeMutex);
+    s_stopping = false;
+  }
+
+  for (uint32_t i = 0; i < workerCount; ++i)
+  {
+    s_queues.push_back(std::make_unique<WorkerQueue>());
+  }
+
+  for (uint32_t i = 0; i < workerCount; ++i)
+  {
+    s_workers.emplace_back(workerLoop, static_cast<int32_t>(i));
+  }
+}
+
+void JobSystem::shutdown()
+{
+  {
+    std::lock_guard lock(s_wakeMutex);
+    s_stopping = true;
+  }
+  s_wake.notify_all();
+
+  for (auto& worker : s_workers)
+  {
+    worker.join();
+  }
+
+  s_workers.clear();
+  s_queues.clear();
+  s_queued.store(0, std::memory_order_relaxed);
+}
+
+uint32_t JobSystem::getWorkerCount()
+{
+  return static_cast<uint32_t>(s_workers.size());
+}
+
+void JobSystem::parallelFor(const std::string& name, const size_t count, size_t grain,
+                            const std::function<void(size_t, size_t)>& body)
+{
+  const auto start = Clock::now();
+
+  grain = std::max<size_t>(grain, 1);
+  const size_t chunkCount = (count + grain - 1) / grain;
+
+  if (s_workers.empty() || chunkCount <= 1 || s_inChunk)
+  {
+    if (count > 0)
+    {
+      body(0, count);
+    }
+
+    const auto wall = Clock::now() - start;
+    recordStats(name, std::min<size_t>(chunkCount, 1), wall, std::chrono::duration<double>(wall).count());
+    return;
+  }
+
+  Batch batch;
+  batch.body = &body;
+  batch.remaining.store(chunkCount, std::memory_order_relaxed);
+
+  // Deal the chunks round-robin (chunk c to deque c % workers), one lock per deque.
+  const size_t queueCount = s_queues.size();
+  for (size_t queue = 0; queue < queueCount && queue < chunkCount; ++queue)
+  {
+    std::lock_guard lock(s_queues[queue]->mutex);
+    for (size_t chunk = queue; chunk < chunkCount; chunk += queueCount)
+    {
+      s_queues[queue]->chunks.push_back({ &batch, chunk * grain, std::min(count, (chunk + 1) * grain) });
+    }
+  }
+
+  {
+    std::lock_guard lock(s_wakeMutex);
+    s_queued.fetch_add(static_cast<int64_t>(chunkCount), std::memory_order_relaxed);
+  }
+  s_wake.notify_all();
+
+  // Help rather than block: steal chunks until none are left, then wait out the ones still running.
+  while (batch.remaining.load(std::memory_order_acquire) > 0)
+  {
+    Chunk chunk;
+    if (takeChunk(-1, chunk))
+    {
+      runChunk(chunk);
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  recordStats(name, chunkCount, Clock::now() - start,
+              static_cast<double>(batch.busyNanoseconds.load(std::memory_order_relaxed)) * 1e-9);
+
+  if (batch.error)
+  {
+    std::rethrow_exception(batch.error);
+  }
+}
+
+std::vector<JobSystem::JobStats> JobSystem::takeStats()
+{
+  std::lock_guard lock(s_statsMutex);
+
+  std::vector<JobStats> stats;
+  stats.reserve(s_stats.size());
+  for (auto& [name, entry] : s_stats)
+  {
+    stats.push_back(std::move(entry));
+  }
+  s_stats.clear();
+
+  return stats;
+}
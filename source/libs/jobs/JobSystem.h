@@ -0,0 +1,55 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// The engine-wide worker pool. Every data-parallel loop in the simulation (physics integration, the
+// collision pair pass, batched scene queries) runs through parallelFor here rather than opening its own
+// thread team, so one setting sizes all of them to the machine: the server sets it from --workers.
+//
+// Each worker owns a deque of chunks. A parallelFor deals its chunks across the deques, workers pop their
+// own from the back and, once empty, steal from the front of the others', so an uneven loop (one slow
+// chunk) still finishes with every thread busy. The calling thread steals too instead of idling, so a
+// pool of N workers runs a loop on N + 1 threads.
+//
+// Every parallelFor is timed under its name: wall time of the call and the summed time its chunks ran.
+// busy / wall is the parallel speedup the loop actually achieved.
+class JobSystem {
+public:
+  struct JobStats {
+    std::string name;
+    uint64_t runs = 0;
+    uint64_t chunks = 0;
+    double wallSeconds = 0.0;
+    double busySeconds = 0.0;
+  };
+
+  // (Re)start the pool with workerCount worker threads (0 = one per hardware thread, less the caller's).
+  // Not thread-safe against a running parallelFor: call at startup/shutdown. Until it's called every
+  // parallelFor runs inline on the caller.
+  static void configure(uint32_t workerCount);
+
+  // Join the workers. Later parallelFor calls run inline.
+  static void shutdown();
+
+  [[nodiscard]] static uint32_t getWorkerCount();
+
+  // Run body(begin, end) over [0, count) in chunks of at most grain items, on the workers and the calling
+  // thread, returning once every chunk has run. count <= grain (one chunk) runs inline on the caller,
+  // in order - pass grain = count to force a loop serial. So does a call made from inside a chunk, whether
+  // that chunk runs on a worker or on the calling thread (nested loops don't fan out again). The first
+  // exception a chunk throws is rethrown here, after the rest finish.
+  static void parallelFor(const std::string& name, size_t count, size_t grain,
+                          const std::function<void(size_t, size_t)>& body);
+
+  // The per-name timing accumulated since the last call (sorted by name), and reset it.
+  [[nodiscard]] static std::vector<JobStats> takeStats();
+};
+
+
+
+#endif //JOBSYSTEM_H
@@ -1,30 +1,71 @@
 #include "MessageQueue.h"
+#include <utility>
 
 namespace net {
 
+MessageQueue::MessageQueue()
+  : m_head(new Node),
+    m_tail(m_head.load(std::memory_order_relaxed))
+{}
+
+MessageQueue::~MessageQueue()
+{
+  while (m_tail)
+  {
+    delete std::exchange(m_tail, m_tail->next.load(std::memory_order_relaxed));
+  }
+}
+
 void MessageQueue::push(Message message, const int32_t senderId)
 {
-  // The websocket runs on its own thread, so the inbox/outbox are guarded. This is the
-  // thread-safety wrinkle that synchronous script calls don't have.
-  std::lock_guard lock(m_mutex);
+  // The websocket runs on its own thread (one per connection, for some transports), so the inbox is shared.
+  // Swapping in at the head orders the producers; linking the previous head publishes the node to the
+  // consumer (release, paired with the acquire in takeNext).
+  const auto node = new Node{ nullptr, Entry{ std::move(message), senderId } };
 
-  m_messages.push(Entry{ std::move(message), senderId });
+  const auto previous = m_head.exchange(node, std::memory_order_acq_rel);
+  previous->next.store(node, std::memory_order_release);
 }
 
 bool MessageQueue::pop(Message& message, int32_t& senderId)
 {
-  std::lock_guard lock(m_mutex);
-
-  if (m_messages.empty())
+  const auto node = takeNext();
+  if (!node)
   {
     return false;
   }
 
-  message = std::move(m_messages.front().message);
-  senderId = m_messages.front().senderId;
-  m_messages.pop();
+  message = std::move(node->entry.message);
+  senderId = node->entry.senderId;
 
   return true;
 }
 
+size_t MessageQueue::drain(std::vector<Entry>& entries)
+{
+  size_t taken = 0;
+
+  while (const auto node = takeNext())
+  {
+    entries.push_back(std::move(node->entry));
+    ++taken;
+  }
+
+  return taken;
+}
+
+MessageQueue::Node* MessageQueue::takeNext()
+{
+  const auto next = m_tail->next.load(std::memory_order_acquire);
+  if (!next)
+  {
+    return nullptr;
+  }
+
+  // next becomes the stub: its entry is the caller's to move out, and the old stub is done with.
+  delete std::exchange(m_tail, next);
+
+  return next;
+}
+
 }
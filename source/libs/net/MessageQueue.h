@@ -2,29 +2,61 @@
 #define MESSAGEQUEUE_H
 
 #include <Protocol.h>
+#include <atomic>
 #include <cstdint>
-#include <mutex>
-#include <queue>
+#include <vector>
 
 namespace net {
 
+// The inbox between the transport's socket threads (any number of producers) and the one thread that
+// drains it (the server's tick, the client's frame). Lock-free: a push is one atomic exchange plus a store,
+// so socket threads streaming input never wait on each other or on the consumer, and the consumer never
+// takes a lock. Messages from one producer come out in the order it pushed them.
+//
+// An intrusive linked queue (Vyukov's MPSC): producers swap themselves in at the head; the consumer walks
+// from the tail, always leaving the last node it took as the new stub. A producer caught between its swap
+// and its link hides the messages behind it for that instant - the consumer sees the queue end there and
+// picks them up on its next drain.
 class MessageQueue {
 public:
-  // senderId is the stable connection id of the message's origin (server inbox); it is 0 where there is
-  // no distinct sender (the client inbox has a single peer).
+  struct Entry {
+    Message message;
+    // The stable connection id of the message's origin (server inbox); 0 where there is no distinct
+    // sender (the client inbox has a single peer).
+    int32_t senderId = 0;
+  };
+
+  MessageQueue();
+
+  ~MessageQueue();
+
+  MessageQueue(const MessageQueue&) = delete;
+  MessageQueue& operator=(const MessageQueue&) = delete;
+
+  // Any thread.
   void push(Message message, int32_t senderId = 0);
 
+  // The consumer thread only.
   [[nodiscard]] bool pop(Message& message, int32_t& senderId);
 
+  // The consumer thread only: append everything queued to entries, in order. Returns the number taken.
+  size_t drain(std::vector<Entry>& entries);
+
 private:
-  struct Entry {
-    Message message;
-    int32_t senderId = 0;
+  struct Node {
+    std::atomic<Node*> next = nullptr;
+    Entry entry;
   };
 
-  std::mutex m_mutex;
+  // Producers' end: the newest node.
+  alignas(64) std::atomic<Node*> m_head;
+
+  // Consumer's end: the stub, whose successor is the oldest message. Apart from m_head so the consumer's
+  // writes don't bounce the producers' cache line.
+  alignas(64) Node* m_tail;
 
-  std::queue<Entry> m_messages;
+  // The next node after the stub, made the stub in its turn; nullptr when empty (for now).
+  [[nodiscard]] Node* takeNext();
 };
 
 }
@@ -89,18 +89,16 @@ bool NetClient::poll(Message& message)
 {
   // The client has a single peer (the server), so the sender id is meaningless here - discard it.
   int32_t senderId = 0;
+  m_payloads.release(message.releasePayload());
   return m_inbox.pop(message, senderId);
 }
 
 void NetClient::enqueue(const uint8_t type, const uint8_t* data, const int32_t len)
 {
-  Message message(static_cast<MessageType>(type));
-  for (const std::vector<uint8_t> chunks(data, data + len); const auto& chunk : chunks)
-  {
-    message.write(chunk);
-  }
+  auto payload = m_payloads.acquire();
+  payload.assign(data, data + len);
 
-  m_inbox.push(std::move(message));
+  m_inbox.push(Message(static_cast<MessageType>(type), std::move(payload)));
 }
 
 }
@@ -2,6 +2,7 @@
 #define NETCLIENT_H
 
 #include "MessageQueue.h"
+#include "PayloadPool.h"
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -22,10 +23,12 @@ public:
 
   [[nodiscard]] bool isConnected() const { return m_connected; }
 
+  // message's previous payload is recycled for the next inbound message (see NetServer::poll).
   [[nodiscard]] bool poll(Message& message);
 
   // Called from the C# socket thread (via the registered native callback) to hand an inbound message
-  // (snapshot on join, state delta per tick) to the render thread; the inbox is mutex-protected.
+  // (snapshot on join, state delta per tick) to the render thread; the inbox is lock-free. data is
+  // copied once, into a pooled buffer.
   void enqueue(uint8_t type, const uint8_t* data, int32_t len);
 
 private:
@@ -33,6 +36,9 @@ private:
 
   MessageQueue m_inbox;
 
+  // The inbox messages' payload buffers, recycled between enqueue and poll.
+  PayloadPool m_payloads;
+
   bool m_connected = false;
 
   // Resolved [UnmanagedCallersOnly] entrypoints in the C# transport assembly.
@@ -13,6 +13,7 @@ namespace {
   using ServerStartFn = void(*)(int32_t, uint8_t, const char*);
   using ServerStopFn = void(*)();
   using ServerBroadcastFn = void(*)(uint8_t, const uint8_t*, int32_t);
+  using ServerSendFn = void(*)(int32_t, uint8_t, const uint8_t*, int32_t);
   using ServerConnectionCountFn = int32_t(*)();
   using SetCallbackFn = void(*)(void*);
 
@@ -54,6 +55,7 @@ void NetServer::start(const int port, const bool editMode, const std::string& au
   m_startFn = m_host->getDelegate(kAssembly, kType, "serverStart");
   m_stopFn = m_host->getDelegate(kAssembly, kType, "serverStop");
   m_broadcastFn = m_host->getDelegate(kAssembly, kType, "serverBroadcast");
+  m_sendFn = m_host->getDelegate(kAssembly, kType, "serverSend");
   m_connectionCountFn = m_host->getDelegate(kAssembly, kType, "serverConnectionCount");
   m_setCallbackFn = m_host->getDelegate(kAssembly, kType, "serverSetReceiveCallback");
   m_setDisconnectCallbackFn = m_host->getDelegate(kAssembly, kType, "serverSetDisconnectCallback");
@@ -94,6 +96,21 @@ void NetServer::broadcast(const Message& message) const
   );
 }
 
+void NetServer::send(const int32_t connId, const Message& message) const
+{
+  if (!m_started)
+  {
+    return;
+  }
+
+  reinterpret_cast<ServerSendFn>(m_sendFn)(
+    connId,
+    static_cast<uint8_t>(message.getType()),
+    message.bytes().data(),
+    static_cast<int32_t>(message.size())
+  );
+}
+
 int NetServer::connectionCount() const
 {
   if (!m_started)
@@ -106,18 +123,27 @@ int NetServer::connectionCount() const
 
 bool NetServer::poll(Message& message, int32_t& senderId)
 {
+  m_payloads.release(message.releasePayload());
   return m_inbox.pop(message, senderId);
 }
 
-void NetServer::enqueue(const int32_t connId, const uint8_t type, const uint8_t* data, const int32_t len)
+void NetServer::drain(std::vector<MessageQueue::Entry>& entries)
 {
-  Message message(static_cast<MessageType>(type));
-  for (const std::vector<uint8_t> chunks(data, data + len); const auto& chunk : chunks)
+  for (auto& entry : entries)
   {
-    message.write(chunk);
+    m_payloads.release(entry.message.releasePayload());
   }
 
-  m_inbox.push(std::move(message), connId);
+  entries.clear();
+  m_inbox.drain(entries);
+}
+
+void NetServer::enqueue(const int32_t connId, const uint8_t type, const uint8_t* data, const int32_t len)
+{
+  auto payload = m_payloads.acquire();
+  payload.assign(data, data + len);
+
+  m_inbox.push(Message(static_cast<MessageType>(type), std::move(payload)), connId);
 }
 
 void NetServer::enqueueDisconnect(const int32_t connId)
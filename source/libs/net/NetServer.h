@@ -2,6 +2,7 @@
 #define NETSERVER_H
 
 #include "MessageQueue.h"
+#include "PayloadPool.h"
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -24,17 +25,26 @@ public:
 
   void broadcast(const Message& message) const;
 
+  // To the one connection connId (the senderId poll() reports); a no-op if it has since dropped.
+  void send(int32_t connId, const Message& message) const;
+
   // The number of clients currently connected to the transport. Used by an ephemeral (editor/client-
   // spawned) server to detect when its last connection drops; returns 0 before start().
   [[nodiscard]] int connectionCount() const;
 
   // senderId is set to the stable connection id of the message's origin, so the app can route input to
-  // the right per-connection slot.
+  // the right per-connection slot. message's previous payload is recycled for the next inbound message,
+  // so drain into the same Message rather than a fresh one each time.
   [[nodiscard]] bool poll(Message& message, int32_t& senderId);
 
+  // poll() in bulk: replace entries with every message queued, in order. Their previous payloads are
+  // recycled as poll's are, so keep passing the same vector.
+  void drain(std::vector<MessageQueue::Entry>& entries);
+
   // Called from the C# socket thread (via the registered native callback) to hand an inbound message
-  // to the tick thread; the inbox is mutex-protected so the threads never collide. connId is the stable
-  // per-connection id the transport assigns each client.
+  // to the tick thread; the inbox is a lock-free queue, so the socket threads never wait on each other or
+  // on the tick. connId is the stable per-connection id the transport assigns each client. data is copied
+  // once, into a pooled buffer.
   void enqueue(int32_t connId, uint8_t type, const uint8_t* data, int32_t len);
 
   // Called from the C# socket thread when a connection drops; the connId is buffered for the tick thread
@@ -49,6 +59,9 @@ private:
 
   MessageQueue m_inbox;
 
+  // The inbox messages' payload buffers, recycled between enqueue and poll.
+  PayloadPool m_payloads;
+
   // Dropped connection ids pushed from the socket threads, drained on the tick thread.
   std::mutex m_disconnectMutex;
   std::vector<int32_t> m_disconnected;
@@ -60,6 +73,7 @@ private:
   void* m_startFn = nullptr;
   void* m_stopFn = nullptr;
   void* m_broadcastFn = nullptr;
+  void* m_sendFn = nullptr;
   void* m_connectionCountFn = nullptr;
   void* m_setCallbackFn = nullptr;
   void* m_setDisconnectCallbackFn = nullptr;
@@ -0,0 +1,85 @@
+#include "PayloadPool.h"
+
+namespace net {
+
+PayloadPool::PayloadPool()
+{
+  for (size_t i = 0; i < maxBuffers; ++i)
+  {
+    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+std::vector<uint8_t> PayloadPool::acquire()
+{
+  size_t position = m_acquirePosition.load(std::memory_order_relaxed);
+
+  while (true)
+  {
+    auto& slot = m_slots[position & (maxBuffers - 1)];
+    const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    const auto lag = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+    if (lag < 0)
+    {
+      // Nothing released here yet (or the release is still mid-way): don't wait for it.
+      return {};
+    }
+
+    if (lag > 0)
+    {
+      // Another thread took this position first.
+      position = m_acquirePosition.load(std::memory_order_relaxed);
+      continue;
+    }
+
+    if (m_acquirePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+    {
+      auto buffer = std::move(slot.buffer);
+      slot.sequence.store(position + maxBuffers, std::memory_order_release);
+
+      return buffer;
+    }
+  }
+}
+
+void PayloadPool::release(std::vector<uint8_t> buffer)
+{
+  if (buffer.capacity() == 0 || buffer.capacity() > maxCapacity)
+  {
+    return;
+  }
+
+  buffer.clear();
+
+  size_t position = m_releasePosition.load(std::memory_order_relaxed);
+
+  while (true)
+  {
+    auto& slot = m_slots[position & (maxBuffers - 1)];
+    const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    const auto lag = static_cast<std::ptrdiff_t>(sequence - position);
+
+    if (lag < 0)
+    {
+      // Full (or the acquire a lap behind is still mid-way): let this one go.
+      return;
+    }
+
+    if (lag > 0)
+    {
+      position = m_releasePosition.load(std::memory_order_relaxed);
+      continue;
+    }
+
+    if (m_releasePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+    {
+      slot.buffer = std::move(buffer);
+      slot.sequence.store(position + 1, std::memory_order_release);
+
+      return;
+    }
+  }
+}
+
+}
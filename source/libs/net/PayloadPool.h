@@ -0,0 +1,59 @@
+#ifndef PAYLOADPOOL_H
+#define PAYLOADPOOL_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace net {
+
+// Recycled message payload buffers for the receive path. The socket thread takes a buffer, copies an
+// inbound frame into it and adopts it as the Message; the poll on the tick thread hands the previous
+// message's buffer back. With the usual drain loop (one Message polled into over and over) the buffers
+// go round, so a steady stream of messages costs one copy each and no allocation.
+//
+// Lock-free, like the inbox it feeds: a bounded ring of maxBuffers slots (Vyukov's MPMC queue), each
+// slot's sequence saying whether it holds a buffer for the current lap. Neither side ever waits - an
+// acquire that finds no buffer ready allocates, a release that finds the ring full frees.
+class PayloadPool {
+public:
+  PayloadPool();
+
+  PayloadPool(const PayloadPool&) = delete;
+  PayloadPool& operator=(const PayloadPool&) = delete;
+
+  // An empty buffer, keeping whatever capacity it had, or a new one. Any thread.
+  [[nodiscard]] std::vector<uint8_t> acquire();
+
+  // Take a buffer back. One grown past maxCapacity (a project load) is freed instead, so a one-off large
+  // message isn't held for the life of the connection. Any thread.
+  void release(std::vector<uint8_t> buffer);
+
+private:
+  static constexpr size_t maxBuffers = 64;
+  static constexpr size_t maxCapacity = 64 * 1024;
+
+  static_assert((maxBuffers & (maxBuffers - 1)) == 0, "maxBuffers must be a power of two");
+
+  struct Slot {
+    // position + 1 once the release at position has filled it; position + maxBuffers once the acquire
+    // at position has emptied it for the next lap.
+    std::atomic<size_t> sequence;
+    std::vector<uint8_t> buffer;
+  };
+
+  std::array<Slot, maxBuffers> m_slots;
+
+  // The next position to acquire from and to release into, on their own cache lines: the socket threads
+  // contend on the one, the tick thread writes the other.
+  alignas(64) std::atomic<size_t> m_acquirePosition{ 0 };
+  alignas(64) std::atomic<size_t> m_releasePosition{ 0 };
+};
+
+}
+
+
+
+#endif //PAYLOADPOOL_H
@@ -21,7 +21,8 @@ internal sealed class TcpBackend : TransportBackend
   private Thread? _acceptThread;
   private volatile bool _serverRunning;
 
-  private readonly List<TcpClient> _clients = new();
+  // Keyed by connection id, so a send can be addressed to one client.
+  private readonly Dictionary<int, TcpClient> _clients = new();
   private readonly object _clientsLock = new();
 
   // A stable, monotonically-increasing id handed to each accepted connection, surfaced to C++ on every
@@ -62,7 +63,7 @@ internal sealed class TcpBackend : TransportBackend
 
     lock (_clientsLock)
     {
-      foreach (var client in _clients)
+      foreach (var client in _clients.Values)
       {
         try { client.Close(); } catch { /* ignore */ }
       }
@@ -85,22 +86,43 @@ internal sealed class TcpBackend : TransportBackend
 
     lock (_clientsLock)
     {
-      for (var i = _clients.Count - 1; i >= 0; --i)
+      foreach (var connId in new List<int>(_clients.Keys))
       {
-        try
-        {
-          _clients[i].GetStream().Write(frame, 0, frame.Length);
-        }
-        catch
-        {
-          // The connection dropped mid-send; reap it.
-          try { _clients[i].Close(); } catch { /* ignore */ }
-          _clients.RemoveAt(i);
-        }
+        SendFrame(connId, frame);
       }
     }
   }
 
+  public override void ServerSend(int connId, byte type, nint data, int len)
+  {
+    var frame = Frame(type, data, len);
+
+    lock (_clientsLock)
+    {
+      SendFrame(connId, frame);
+    }
+  }
+
+  // Caller holds _clientsLock. An unknown connId (already dropped) is ignored.
+  private void SendFrame(int connId, byte[] frame)
+  {
+    if (!_clients.TryGetValue(connId, out var client))
+    {
+      return;
+    }
+
+    try
+    {
+      client.GetStream().Write(frame, 0, frame.Length);
+    }
+    catch
+    {
+      // The connection dropped mid-send; reap it.
+      try { client.Close(); } catch { /* ignore */ }
+      _clients.Remove(connId);
+    }
+  }
+
   private void AcceptLoop()
   {
     while (_serverRunning)
@@ -121,7 +143,7 @@ internal sealed class TcpBackend : TransportBackend
 
       lock (_clientsLock)
       {
-        _clients.Add(client);
+        _clients.Add(connId, client);
       }
 
       var thread = new Thread(() => ServerReceiveLoop(client, connId))
@@ -166,7 +188,7 @@ internal sealed class TcpBackend : TransportBackend
 
     lock (_clientsLock)
     {
-      _clients.Remove(client);
+      _clients.Remove(connId);
     }
 
     try { client.Close(); } catch { /* ignore */ }
@@ -73,6 +73,12 @@ public static unsafe class Transport
     _backend.ServerBroadcast(type, data, len);
   }
 
+  [UnmanagedCallersOnly]
+  public static void serverSend(int connId, byte type, IntPtr data, int len)
+  {
+    _backend.ServerSend(connId, type, data, len);
+  }
+
   [UnmanagedCallersOnly]
   public static void clientSetReceiveCallback(IntPtr fn)
   {
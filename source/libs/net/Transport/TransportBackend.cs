@@ -35,6 +35,8 @@ internal abstract class TransportBackend
   public abstract void ServerStop();
   public abstract int ServerConnectionCount();
   public abstract void ServerBroadcast(byte type, nint data, int len);
+  // To one connection; a connId that has already dropped is ignored.
+  public abstract void ServerSend(int connId, byte type, nint data, int len);
 
   public abstract byte ClientConnect(string host, int port, byte role, string token);
   public abstract void ClientDisconnect();
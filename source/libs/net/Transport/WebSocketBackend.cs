@@ -66,8 +66,9 @@ internal sealed class WebSocketBackend : TransportBackend
 
   // A WebSocket is safe for one concurrent send and one concurrent receive, but not for concurrent sends.
   // The send lock serializes broadcasts (and any future sender) onto a single connection.
-  private sealed class Connection(WebSocket socket, CancellationTokenSource cts)
+  private sealed class Connection(int connId, WebSocket socket, CancellationTokenSource cts)
   {
+    public readonly int ConnId = connId;
     public readonly WebSocket Socket = socket;
     public readonly CancellationTokenSource Cts = cts;
     public readonly SemaphoreSlim SendLock = new(1, 1);
@@ -137,6 +138,22 @@ internal sealed class WebSocketBackend : TransportBackend
     }
   }
 
+  public override void ServerSend(int connId, byte type, nint data, int len)
+  {
+    var message = BuildMessage(type, data, len);
+
+    lock (_clientsLock)
+    {
+      var i = _connections.FindIndex(conn => conn.ConnId == connId);
+      if (i >= 0 && !SendMessage(_connections[i], message))
+      {
+        // The connection dropped mid-send; reap it.
+        Close(_connections[i].Socket, _connections[i].Cts);
+        _connections.RemoveAt(i);
+      }
+    }
+  }
+
   private void AcceptLoop()
   {
     while (_serverRunning)
@@ -194,7 +211,7 @@ internal sealed class WebSocketBackend : TransportBackend
 
       connId = Interlocked.Increment(ref _nextConnId);
 
-      conn = new Connection(ws, cts);
+      conn = new Connection(connId, ws, cts);
       lock (_clientsLock)
       {
         _connections.Add(conn);
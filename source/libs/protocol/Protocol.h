@@ -8,6 +8,7 @@
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace net {
@@ -17,11 +18,18 @@ namespace net {
 // box instead of defaulting to port 0.
 inline constexpr int defaultPort = 3000;
 
+// The server's fixed simulation rate, in ticks per second. Each state delta is stamped with its tick, so
+// a client reading the stream can place it in server time.
+inline constexpr int tickRate = 50;
+
 enum class MessageType : uint8_t {
   undefined,
   join,         // client -> server: request the initial Snapshot (carries role + auth at handshake)
-  snapshot,     // server -> client: full project/scene state (ProjectPacker::pack())
-  stateDelta,   // server -> client: per-tick transform stream, packed binary (replication::packStateDelta)
+  snapshot,     // server -> client: full project/scene state (ProjectPacker::pack()); to the joiner alone on
+                // join, to all after a structural change
+  stateDelta,   // server -> client: per-tick transform stream, packed binary against the client's last
+                // acked tick, stamped with the simulation tick and echoing the last moveInput the server
+                // applied (replication::packStateDelta)
   inputState,    // client -> server: local input for the scripts to read. Payload: focused (bool),
                  // key count (size_t) + that many key codes (int), then the mouse block: mouseX, mouseY,
                  // mouseDeltaX, mouseDeltaY, scrollY (5x float), buttons (uint8 bitmask L/R/M)
@@ -30,15 +38,17 @@ enum class MessageType : uint8_t {
   sceneControl,  // editor -> server: scene lifecycle (SceneControlOp + optional scene uuid); server re-snapshots
   loadProject,   // editor -> server: replace the project with this serialized blob; server re-snapshots
   addAsset,      // editor -> server: register a new asset (model/texture/script/scene); server re-snapshots
-  editStatus,    // server -> client: whether this server accepts edits ({ editable: bool }); sent on join
+  editStatus,    // server -> joining client: whether this server accepts edits ({ editable: bool })
   sceneStatus,   // server -> client: current scene lifecycle state ({ status: "running"|"paused"|"stopped" })
   objectSpawned, // server -> client: one object created at runtime (Object::pack); spliced into the scene
-  objectDestroyed, // server -> client: uuid of an object removed at runtime; the client drops it from the scene
-  playerSlot,    // server -> all: (nonce uint64, slot int32) - the player slot bound to the client whose
-                 // join carried this nonce. Broadcast + nonce correlation (no per-connection send path):
-                 // every client hears it, only the one whose join nonce matches keeps it.
+  objectDestroyed, // server -> client: network id of an object removed at runtime; the client drops it from the scene
+  playerSlot,    // server -> joining client: (slot int32) - the player slot bound to its connection
   renameAsset,   // editor -> server: set an asset's display-name override (replication::packRenameAsset); server re-snapshots
-  removeAsset    // editor -> server: drop an asset record by uuid (replication::packRemoveAsset); server re-snapshots
+  removeAsset,   // editor -> server: drop an asset record by uuid (replication::packRemoveAsset); server re-snapshots
+  stateAck,      // client -> server: tick (uint32) of the last stateDelta applied; the server encodes that
+                 // client's next deltas against it (replication::buildStateAck)
+  moveInput      // client -> server: one tick's PlayerController move buttons, numbered (replication::buildMoveInput);
+                 // the server applies one per tick, in order
   // editComponent/sceneEdit/sceneControl/loadProject/addAsset/renameAsset/removeAsset are the editor's mutation path; the server
   // only honors them from a connection it authorized as Role::editor at the transport handshake (which
   // carries role + token out of band, ahead of any message here), and only on an edit-mode server. An
@@ -67,6 +77,10 @@ public:
   explicit Message(const MessageType type) noexcept : type(type) {}
   Message() {}
 
+  // Adopt payload as the body, without copying it: the receive path fills a buffer and hands it over.
+  Message(const MessageType type, std::vector<uint8_t> payload) noexcept
+    : type(type), m_payload(std::move(payload)) {}
+
   template <Trivial T>
   Message& write(const T& value) {
     const auto raw = std::bit_cast<std::array<uint8_t, sizeof(T)>>(value);
@@ -74,6 +88,25 @@ public:
     return *this;
   }
 
+  // Unsigned LEB128: seven bits a byte, low group first, high bit set on every byte but the last. Small
+  // values (ids, counts, deltas) take one or two bytes instead of a fixed four or eight. The pairing read
+  // is MessageReader::readVarint.
+  Message& writeVarint(uint64_t value) {
+    while (value >= 0x80)
+    {
+      m_payload.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    m_payload.push_back(static_cast<uint8_t>(value));
+    return *this;
+  }
+
+  // Raw bytes, appended in one go.
+  Message& writeBytes(const std::span<const uint8_t> bytes) {
+    m_payload.insert(m_payload.end(), bytes.begin(), bytes.end());
+    return *this;
+  }
+
   // Length-prefixed string (uint32 size + bytes). The pairing read is MessageReader::readString.
   Message& writeString(const std::string& value) {
     write(static_cast<uint32_t>(value.size()));
@@ -86,6 +119,12 @@ public:
 
   [[nodiscard]] MessageType getType() const noexcept { return type; }
 
+  // Hand the payload buffer back (leaving the message empty and untyped), so its capacity can be reused.
+  [[nodiscard]] std::vector<uint8_t> releasePayload() noexcept {
+    type = MessageType::undefined;
+    return std::exchange(m_payload, {});
+  }
+
 private:
   MessageType type = MessageType::undefined;
   std::vector<uint8_t> m_payload;
@@ -106,6 +145,21 @@ public:
     return std::bit_cast<T>(raw);
   }
 
+  // Reads a varint written by Message::writeVarint. More than ten bytes can't be a uint64, so a run that
+  // long is malformed rather than something to keep shifting.
+  [[nodiscard]] uint64_t readVarint() {
+    uint64_t value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+      const auto byte = read<uint8_t>();
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+        return value;
+    }
+
+    throw std::runtime_error("Malformed varint");
+  }
+
   // Reads a length-prefixed string written by Message::writeString.
   [[nodiscard]] std::string readString() {
     const auto size = read<uint32_t>();
@@ -85,11 +85,13 @@ std::shared_ptr<vke::RenderObject> GpuAssetCache::getRenderObject(const uuids::u
   return renderObject;
 }
 
-std::shared_ptr<vke::RenderObject> GpuAssetCache::getColliderGizmo(const uuids::uuid& ownerUUID, const std::string& modelPath)
+std::shared_ptr<vke::RenderObject> GpuAssetCache::getColliderGizmo(const uuids::uuid& ownerUUID, const std::string& modelPath,
+                                                                   const size_t shape)
 {
-  if (const auto it = m_colliderGizmos.find(ownerUUID); it != m_colliderGizmos.end() && it->second.path == modelPath)
+  auto& gizmos = m_colliderGizmos[ownerUUID];
+  if (shape < gizmos.size() && gizmos[shape].renderObject && gizmos[shape].path == modelPath)
   {
-    return it->second.renderObject;
+    return gizmos[shape].renderObject;
   }
 
   const auto model = m_renderer->getAssetManager()->loadModel(modelPath.c_str());
@@ -102,7 +104,11 @@ std::shared_ptr<vke::RenderObject> GpuAssetCache::getColliderGizmo(const uuids::
 
   auto renderObject = m_renderer->getAssetManager()->loadRenderObject(white, white, model);
 
-  m_colliderGizmos[ownerUUID] = { renderObject, modelPath };
+  if (shape >= gizmos.size())
+  {
+    gizmos.resize(shape + 1);
+  }
+  gizmos[shape] = { renderObject, modelPath };
 
   return renderObject;
 }
@@ -1,9 +1,11 @@
 #ifndef GPUASSETCACHE_H
 #define GPUASSETCACHE_H
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <uuid.h>
 
 namespace vke {
@@ -35,9 +37,11 @@ public:
                                                      const uuids::uuid& specularMapUUID);
 
   // A debug render object for a collider's shape (a path-loaded cube/sphere, white, no specular), keyed
-  // per collider OWNER and rebuilt if the model path changes. The RenderSystem draws it with the
-  // objectHighlight pipeline when the collider's render flag is on.
-  std::shared_ptr<vke::RenderObject> getColliderGizmo(const uuids::uuid& ownerUUID, const std::string& modelPath);
+  // per collider OWNER and shape index (a compound collider's shapes each get one; a standalone collider
+  // is shape 0) and rebuilt if the model path changes. The RenderSystem draws it with the objectHighlight
+  // pipeline when the collider's render flag is on.
+  std::shared_ptr<vke::RenderObject> getColliderGizmo(const uuids::uuid& ownerUUID, const std::string& modelPath,
+                                                      size_t shape = 0);
 
 private:
   struct CachedRenderObject {
@@ -59,7 +63,7 @@ private:
   std::unordered_map<uuids::uuid, std::shared_ptr<vke::Model>> m_models;
   std::unordered_map<uuids::uuid, std::shared_ptr<vke::Texture2D>> m_textures;
   std::unordered_map<uuids::uuid, CachedRenderObject> m_renderObjects;
-  std::unordered_map<uuids::uuid, CachedGizmo> m_colliderGizmos;
+  std::unordered_map<uuids::uuid, std::vector<CachedGizmo>> m_colliderGizmos;
 };
 
 
@@ -1,5 +1,6 @@
 #include "RenderSystem.h"
 #include "GpuAssetCache.h"
+#include "TransformInterpolator.h"
 #include <objects/Object.h>
 #include <objects/ObjectManager.h>
 #include <objects/components/Component.h>
@@ -8,6 +9,9 @@
 #include <objects/components/LightRenderer.h>
 #include <objects/components/Camera.h>
 #include <objects/components/collisions/BoxCollider.h>
+#include <objects/components/collisions/CompoundCollider.h>
+#include <objects/components/collisions/ConvexHull.h>
+#include <objects/components/collisions/ConvexHullCollider.h>
 #include <objects/components/collisions/SphereCollider.h>
 #include <glm/vec3.hpp>
 #include <glm/common.hpp>
@@ -40,6 +44,33 @@ namespace {
     camera->enable();
     renderer->getRenderingManager()->getRenderer3D()->setCameraParameters(camera->getPosition(), camera->getViewMatrix());
   }
+
+  // Collider debug gizmos: the shape (offset by its local transform) drawn with the highlight pipeline.
+  // shape is the index within a compound collider (0 for a standalone one).
+  void renderBoxGizmo(GpuAssetCache& assetCache, const uuids::uuid& uuid, const Transform& transform,
+                      const BoxCollider& box, const size_t shape)
+  {
+    if (const auto gizmo = assetCache.getColliderGizmo(uuid, "assets/models/cube_1x1x1.glb", shape))
+    {
+      gizmo->setPosition(transform.getPosition() + box.getLocalPosition());
+      gizmo->setScale(transform.getScale() * box.getLocalScale());
+      gizmo->setOrientationEuler(transform.getRotation() + box.getLocalRotation());
+
+      assetCache.getRenderer()->getRenderingManager()->getRenderer3D()->renderObject(gizmo, vke::PipelineType::objectHighlight);
+    }
+  }
+
+  void renderSphereGizmo(GpuAssetCache& assetCache, const uuids::uuid& uuid, const Transform& transform,
+                         const SphereCollider& sphere, const size_t shape)
+  {
+    if (const auto gizmo = assetCache.getColliderGizmo(uuid, "assets/models/sphere_3.glb", shape))
+    {
+      gizmo->setPosition(transform.getPosition() + sphere.getLocalPosition());
+      gizmo->setScale(transform.getScale() * sphere.getLocalRadius());
+
+      assetCache.getRenderer()->getRenderingManager()->getRenderer3D()->renderObject(gizmo, vke::PipelineType::objectHighlight);
+    }
+  }
 }
 
 void RenderSystem::variableUpdate(const ObjectManager& objectManager, GpuAssetCache& assetCache,
@@ -48,6 +79,11 @@ void RenderSystem::variableUpdate(const ObjectManager& objectManager, GpuAssetCa
   const auto renderer = assetCache.getRenderer();
   const auto lightingManager = renderer->getLightingManager();
 
+  if (m_interpolator)
+  {
+    m_interpolator->apply(objectManager);
+  }
+
   for (const auto& object : objectManager.getAllObjects())
   {
     const auto transform = object->getComponent<Transform>(ComponentType::transform);
@@ -129,25 +165,43 @@ void RenderSystem::variableUpdate(const ObjectManager& objectManager, GpuAssetCa
       }
     }
 
-    // Collider debug gizmo: draw the collider's shape (offset by its local transform) with the
-    // highlight pipeline when its render flag is on.
+    // Collider debug gizmos, when the collider's render flag is on. A compound's flag covers all its shapes.
     if (const auto box = object->getComponent<BoxCollider>(ComponentType::collider); box && box->getRenderCollider())
     {
-      if (const auto gizmo = assetCache.getColliderGizmo(uuid, "assets/models/cube_1x1x1.glb"))
+      renderBoxGizmo(assetCache, uuid, *transform, *box, 0);
+    }
+    else if (const auto sphere = object->getComponent<SphereCollider>(ComponentType::collider); sphere && sphere->getRenderCollider())
+    {
+      renderSphereGizmo(assetCache, uuid, *transform, *sphere, 0);
+    }
+    else if (const auto compound = object->getComponent<CompoundCollider>(ComponentType::collider);
+             compound && compound->getRenderCollider())
+    {
+      const auto& shapes = compound->getShapes();
+      for (size_t i = 0; i < shapes.size(); ++i)
       {
-        gizmo->setPosition(transform->getPosition() + box->getLocalPosition());
-        gizmo->setScale(transform->getScale() * box->getLocalScale());
-        gizmo->setOrientationEuler(transform->getRotation() + box->getLocalRotation());
-
-        renderer->getRenderingManager()->getRenderer3D()->renderObject(gizmo, vke::PipelineType::objectHighlight);
+        if (const auto shapeBox = std::dynamic_pointer_cast<BoxCollider>(shapes[i]))
+        {
+          renderBoxGizmo(assetCache, uuid, *transform, *shapeBox, i);
+        }
+        else if (const auto shapeSphere = std::dynamic_pointer_cast<SphereCollider>(shapes[i]))
+        {
+          renderSphereGizmo(assetCache, uuid, *transform, *shapeSphere, i);
+        }
       }
     }
-    else if (const auto sphere = object->getComponent<SphereCollider>(ComponentType::collider); sphere && sphere->getRenderCollider())
+    else if (const auto hull = object->getComponent<ConvexHullCollider>(ComponentType::collider);
+             hull && hull->getRenderCollider())
     {
-      if (const auto gizmo = assetCache.getColliderGizmo(uuid, "assets/models/sphere_3.glb"))
+      // There's no mesh for the hull itself; its bounding box, which turns with the object, stands in.
+      if (const auto gizmo = assetCache.getColliderGizmo(uuid, "assets/models/cube_1x1x1.glb"))
       {
-        gizmo->setPosition(transform->getPosition() + sphere->getLocalPosition());
-        gizmo->setScale(transform->getScale() * sphere->getLocalRadius());
+        const glm::vec3 min = hull->getHull()->getMin();
+        const glm::vec3 max = hull->getHull()->getMax();
+
+        gizmo->setPosition(glm::vec3(hull->getWorldMatrix() * glm::vec4(0.5f * (min + max), 1.0f)));
+        gizmo->setScale(transform->getScale() * (0.5f * (max - min)));
+        gizmo->setOrientationEuler(transform->getRotation());
 
         renderer->getRenderingManager()->getRenderer3D()->renderObject(gizmo, vke::PipelineType::objectHighlight);
       }
@@ -226,3 +280,13 @@ bool RenderSystem::isSelected(const uuids::uuid& uuid) const
 
   return it != m_selected.end() && it->second;
 }
+
+void RenderSystem::enableInterpolation(const float tickRate, const float delaySeconds)
+{
+  m_interpolator = std::make_shared<TransformInterpolator>(tickRate, delaySeconds);
+}
+
+std::shared_ptr<TransformInterpolator> RenderSystem::getInterpolator() const
+{
+  return m_interpolator;
+}
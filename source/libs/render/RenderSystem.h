@@ -13,6 +13,7 @@ namespace vke {
 
 class ObjectManager;
 class GpuAssetCache;
+class TransformInterpolator;
 
 class RenderSystem {
 public:
@@ -38,6 +39,14 @@ public:
   // True for the object under the cursor; the editor reads it to drive Ctrl-click selection.
   [[nodiscard]] bool isSelected(const uuids::uuid& uuid) const;
 
+  // Render replicated objects delaySeconds behind the server's state stream, interpolated between its
+  // ticks (see TransformInterpolator) rather than stepping as each delta lands. The client feeds the
+  // stream into getInterpolator(); variableUpdate() applies it before drawing. Off unless enabled.
+  void enableInterpolation(float tickRate, float delaySeconds);
+
+  // nullptr while interpolation is off.
+  [[nodiscard]] std::shared_ptr<TransformInterpolator> getInterpolator() const;
+
 private:
   struct CachedLight {
     std::shared_ptr<vke::PointLight> pointLight;
@@ -49,6 +58,8 @@ private:
   std::unordered_map<uuids::uuid, CachedLight> m_lights;
 
   std::unordered_map<uuids::uuid, bool> m_selected;
+
+  std::shared_ptr<TransformInterpolator> m_interpolator;
 };
 
 
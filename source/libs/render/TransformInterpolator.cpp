@@ -0,0 +1,185 @@
+#include "TransformInterpolator.h"
+#include <objects/Object.h>
+#include <objects/ObjectManager.h>
+#include <objects/components/Component.h>
+#include <objects/components/Transform.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  // How far past the newest sample a stalled stream is extrapolated before objects hold still.
+  constexpr double maxExtrapolationSeconds = 0.25;
+
+  // An arrival this far off the smoothed clock is a resync (a hitch, a reconnect), not jitter.
+  constexpr double resyncSeconds = 1.0;
+  constexpr double clockSmoothing = 0.05;
+
+  // Samples kept per object at most, whatever the render time does.
+  constexpr size_t maxSamples = 256;
+
+  // The signed short way from a to b, in degrees: within [-180, 180).
+  float angleDelta(const float a, const float b)
+  {
+    const float delta = std::fmod(b - a + 180.0f, 360.0f);
+    return (delta < 0.0f ? delta + 360.0f : delta) - 180.0f;
+  }
+
+  glm::vec3 angleDelta(const glm::vec3& a, const glm::vec3& b)
+  {
+    return { angleDelta(a.x, b.x), angleDelta(a.y, b.y), angleDelta(a.z, b.z) };
+  }
+}
+
+TransformInterpolator::TransformInterpolator(const float tickRate, const float delaySeconds)
+  : m_tickRate(tickRate > 0.0f ? tickRate : 1.0f),
+    m_delayTicks(std::max(delaySeconds, 0.0f) * m_tickRate)
+{}
+
+void TransformInterpolator::beginTick(const uint32_t tick)
+{
+  if (tick <= m_latestTick)
+  {
+    return;
+  }
+
+  m_previousTick = m_latestTick;
+  m_latestTick = tick;
+
+  // Where this arrival puts the server clock against ours. Averaged, so the jitter of single arrivals
+  // washes out; the delay covers what's left.
+  const double offset = tick / static_cast<double>(m_tickRate) - getSeconds();
+  if (!m_clockSet || std::abs(offset - m_clockOffset) > resyncSeconds)
+  {
+    m_clockOffset = offset;
+    m_clockSet = true;
+    m_lastRenderTick = 0.0;
+  }
+  else
+  {
+    m_clockOffset += (offset - m_clockOffset) * clockSmoothing;
+  }
+}
+
+void TransformInterpolator::push(const uint32_t networkID, const Pose& pose, const Pose& current)
+{
+  auto& samples = m_samples[networkID];
+
+  if (samples.empty())
+  {
+    samples.push_back({ m_previousTick, current });
+  }
+  else if (samples.back().tick < m_previousTick)
+  {
+    // Absent from the deltas since its last sample: it held that pose until the previous delta.
+    samples.push_back({ m_previousTick, samples.back().pose });
+  }
+
+  if (samples.back().tick == m_latestTick)
+  {
+    samples.back().pose = pose;
+  }
+  else
+  {
+    samples.push_back({ m_latestTick, pose });
+  }
+
+  while (samples.size() > maxSamples)
+  {
+    samples.pop_front();
+  }
+}
+
+void TransformInterpolator::apply(const ObjectManager& objectManager)
+{
+  if (!m_clockSet)
+  {
+    return;
+  }
+
+  const double renderTick = std::max((getSeconds() + m_clockOffset) * m_tickRate - m_delayTicks, m_lastRenderTick);
+  m_lastRenderTick = renderTick;
+
+  for (auto entry = m_samples.begin(); entry != m_samples.end();)
+  {
+    const auto object = objectManager.getObjectByNetworkID(entry->first);
+    if (!object)
+    {
+      entry = m_samples.erase(entry);
+      continue;
+    }
+
+    // Keep one sample at or before the render time to interpolate from; everything older is spent. The
+    // last two stay regardless, for extrapolating past the newest.
+    auto& samples = entry->second;
+    while (samples.size() > 2 && samples[1].tick <= renderTick)
+    {
+      samples.pop_front();
+    }
+
+    if (const auto transform = object->getComponent<Transform>(ComponentType::transform);
+        transform && transform->getOwner() == object.get())
+    {
+      const auto pose = sample(samples, renderTick);
+      transform->setPosition(pose.position);
+      transform->setRotation(pose.rotation);
+      transform->setScale(pose.scale);
+    }
+
+    ++entry;
+  }
+}
+
+void TransformInterpolator::erase(const uint32_t networkID)
+{
+  m_samples.erase(networkID);
+}
+
+void TransformInterpolator::clear()
+{
+  m_samples.clear();
+}
+
+double TransformInterpolator::getSeconds() const
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+TransformInterpolator::Pose TransformInterpolator::sample(const std::deque<Sample>& samples,
+                                                          const double renderTick) const
+{
+  const auto& from = samples.front();
+  if (samples.size() == 1 || renderTick <= from.tick)
+  {
+    return from.pose;
+  }
+
+  const auto& to = samples[1];
+  const double span = to.tick - from.tick;
+
+  if (renderTick <= to.tick)
+  {
+    const auto t = static_cast<float>((renderTick - from.tick) / span);
+
+    return {
+      from.pose.position + (to.pose.position - from.pose.position) * t,
+      from.pose.rotation + angleDelta(from.pose.rotation, to.pose.rotation) * t,
+      from.pose.scale + (to.pose.scale - from.pose.scale) * t
+    };
+  }
+
+  // Past the newest sample. Newer deltas without the object mean it stopped there; otherwise the stream
+  // has stalled, and an object that was moving carries on at its last velocity for a while, then holds.
+  if (to.tick < m_latestTick)
+  {
+    return to.pose;
+  }
+
+  const double ahead = std::min(renderTick - to.tick, maxExtrapolationSeconds * m_tickRate);
+  const auto steps = static_cast<float>(ahead / span);
+
+  return {
+    to.pose.position + (to.pose.position - from.pose.position) * steps,
+    to.pose.rotation + angleDelta(from.pose.rotation, to.pose.rotation) * steps,
+    to.pose.scale
+  };
+}
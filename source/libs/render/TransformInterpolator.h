@@ -0,0 +1,80 @@
+#ifndef TRANSFORMINTERPOLATOR_H
+#define TRANSFORMINTERPOLATOR_H
+
+#include <glm/vec3.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+class ObjectManager;
+
+// Client-side smoothing of the state delta stream. Deltas arrive at the server's tick rate, jittered by
+// the network, while the view renders as fast as it can; writing each delta straight into the scene
+// shows both as stepping. Instead the view buffers each object's received local transforms by server tick
+// and renders the pose from a fixed delay behind its estimate of the server's current tick, interpolated
+// between the two samples either side. The delay absorbs the jitter (and a lower send rate): as long as
+// the next delta lands within it, motion is continuous. When the stream stalls past it, objects that were
+// moving carry on at their last velocity for a short while, then hold.
+//
+// Rotations are Euler degrees, interpolated per axis the short way round (they're replicated wrapped to
+// [-180, 180), so 179 -> -179 is a 2 degree turn, not 358).
+class TransformInterpolator {
+public:
+  struct Pose {
+    glm::vec3 position{ 0.0f };
+    glm::vec3 rotation{ 0.0f };
+    glm::vec3 scale{ 1.0f };
+  };
+
+  TransformInterpolator(float tickRate, float delaySeconds);
+
+  // A delta for tick arrived; its entries follow as push() calls. Ticks only go forward.
+  void beginTick(uint32_t tick);
+
+  // An entry of the current tick's delta. current is the pose the object shows now, which a newly
+  // buffered object starts from rather than jumping to its first sample a delay early.
+  void push(uint32_t networkID, const Pose& pose, const Pose& current);
+
+  // Write every buffered object's pose at the render time into its (local) Transform. Objects no longer
+  // in objectManager are dropped.
+  void apply(const ObjectManager& objectManager);
+
+  // Stop driving an object (one the client now moves itself), leaving it where it is.
+  void erase(uint32_t networkID);
+
+  // A snapshot rebuilt the scene: nothing buffered applies to it any more.
+  void clear();
+
+private:
+  struct Sample {
+    uint32_t tick;
+    Pose pose;
+  };
+
+  float m_tickRate;
+  double m_delayTicks;
+
+  std::unordered_map<uint32_t, std::deque<Sample>> m_samples;
+
+  // The newest delta's tick, and the one before it: an object absent from the deltas in between stood
+  // still, so it holds its previous sample up to m_previousTick.
+  uint32_t m_latestTick = 0;
+  uint32_t m_previousTick = 0;
+
+  // Server time minus local time (seconds), smoothed over the deltas' arrival times.
+  std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+  double m_clockOffset = 0.0;
+  bool m_clockSet = false;
+
+  // Render time never steps backwards as the offset settles, short of a resync.
+  double m_lastRenderTick = 0.0;
+
+  [[nodiscard]] double getSeconds() const;
+
+  [[nodiscard]] Pose sample(const std::deque<Sample>& samples, double renderTick) const;
+};
+
+
+
+#endif //TRANSFORMINTERPOLATOR_H
@@ -17,6 +17,79 @@ public unsafe struct WorldBindings
     public delegate* unmanaged<float, float, float, float, float, float, float, uint, IntPtr, IntPtr> raycast;
     public delegate* unmanaged<float, float, float, float, uint, IntPtr, IntPtr> overlapSphere;
     public delegate* unmanaged<IntPtr, float, float, float, IntPtr> spawnPrefab;
+    public delegate* unmanaged<RaycastQueryData*, uint, RaycastHitData*, void> raycastBatch;
+    public delegate* unmanaged<OverlapSphereQueryData*, uint, uint*, byte*> overlapSphereBatch;
+    public delegate* unmanaged<float, float, float, float, float, float, float, float, uint, IntPtr, IntPtr> sphereCast;
+    public delegate* unmanaged<float, float, float, float, float, float, float, float, float, float, float, float,
+        float, uint, IntPtr, IntPtr> boxCast;
+}
+
+// Batch records, field-for-field mirrors of the native structs in WorldBindings.h. Uuids are their 16 raw
+// bytes (all zero = none); World formats/parses them, so scripts only ever see the query structs below.
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct RaycastQueryData
+{
+    public float ox, oy, oz;
+    public float dx, dy, dz;
+    public float maxDistance;
+    public uint layerMask;
+    public fixed byte ignoreUuid[16];
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct RaycastHitData
+{
+    public uint hit;
+    public fixed byte objectUuid[16];
+    public float distance;
+    public float px, py, pz;
+    public float nx, ny, nz;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct OverlapSphereQueryData
+{
+    public float cx, cy, cz;
+    public float radius;
+    public uint layerMask;
+    public fixed byte ignoreUuid[16];
+}
+
+// One ray of a World.raycastBatch call; the fields mean what World.raycast's parameters do.
+public struct RaycastQuery
+{
+    public Vector3 origin;
+    public Vector3 direction;
+    public float maxDistance;
+    public uint layerMask;
+    public string ignoreUuid;
+
+    public RaycastQuery(Vector3 origin, Vector3 direction, float maxDistance, uint layerMask = 0xFFFFFFFFu,
+                        string ignoreUuid = "")
+    {
+        this.origin = origin;
+        this.direction = direction;
+        this.maxDistance = maxDistance;
+        this.layerMask = layerMask;
+        this.ignoreUuid = ignoreUuid;
+    }
+}
+
+// One sphere of a World.overlapSphereBatch call; the fields mean what World.overlapSphere's parameters do.
+public struct OverlapSphereQuery
+{
+    public Vector3 center;
+    public float radius;
+    public uint layerMask;
+    public string ignoreUuid;
+
+    public OverlapSphereQuery(Vector3 center, float radius, uint layerMask = 0xFFFFFFFFu, string ignoreUuid = "")
+    {
+        this.center = center;
+        this.radius = radius;
+        this.layerMask = layerMask;
+        this.ignoreUuid = ignoreUuid;
+    }
 }
 
 // The result of a successful World.raycast: the object hit and where.
@@ -186,8 +259,6 @@ public static unsafe class World
     public static bool raycast(Vector3 origin, Vector3 direction, float maxDistance, out RaycastHit hit,
                                uint layerMask = 0xFFFFFFFFu, string ignoreUuid = "")
     {
-        hit = default;
-
         var ignorePtr = Marshal.StringToCoTaskMemUTF8(ignoreUuid);
         string raw;
         try
@@ -204,6 +275,61 @@ public static unsafe class World
             Marshal.FreeCoTaskMem(ignorePtr);
         }
 
+        return parseHit(raw, out hit);
+    }
+
+    // Sweep a sphere of the given radius from origin along direction and report the first collider (layer in
+    // layerMask) it would touch within maxDistance. hit.distance is how far the sphere can move before
+    // touching, so a character controller can advance by exactly that; hit.normal points from the touched
+    // surface back toward the sphere. A sphere that starts overlapping something reports it at distance 0.
+    // One sweep replaces the fan of rays otherwise needed to approximate a body's volume.
+    public static bool sphereCast(Vector3 origin, float radius, Vector3 direction, float maxDistance,
+                                  out RaycastHit hit, uint layerMask = 0xFFFFFFFFu, string ignoreUuid = "")
+    {
+        var ignorePtr = Marshal.StringToCoTaskMemUTF8(ignoreUuid);
+        string raw;
+        try
+        {
+            raw = Marshal.PtrToStringUTF8(NativeBindings.World.sphereCast(
+                origin.X, origin.Y, origin.Z, radius, direction.X, direction.Y, direction.Z,
+                maxDistance, layerMask, ignorePtr)) ?? "";
+        }
+        finally
+        {
+            Marshal.FreeCoTaskMem(ignorePtr);
+        }
+
+        return parseHit(raw, out hit);
+    }
+
+    // sphereCast for an oriented box: halfExtents along its local axes, rotation in Euler degrees (the same
+    // convention as Transform.rotation).
+    public static bool boxCast(Vector3 center, Vector3 halfExtents, Vector3 rotation, Vector3 direction,
+                               float maxDistance, out RaycastHit hit, uint layerMask = 0xFFFFFFFFu,
+                               string ignoreUuid = "")
+    {
+        var ignorePtr = Marshal.StringToCoTaskMemUTF8(ignoreUuid);
+        string raw;
+        try
+        {
+            raw = Marshal.PtrToStringUTF8(NativeBindings.World.boxCast(
+                center.X, center.Y, center.Z, halfExtents.X, halfExtents.Y, halfExtents.Z,
+                rotation.X, rotation.Y, rotation.Z, direction.X, direction.Y, direction.Z,
+                maxDistance, layerMask, ignorePtr)) ?? "";
+        }
+        finally
+        {
+            Marshal.FreeCoTaskMem(ignorePtr);
+        }
+
+        return parseHit(raw, out hit);
+    }
+
+    // Parse a native "uuid,dist,px,py,pz,nx,ny,nz" hit ("" = miss) shared by raycast and the shape casts.
+    private static bool parseHit(string raw, out RaycastHit hit)
+    {
+        hit = default;
+
         if (raw.Length == 0)
         {
             return false;
@@ -250,4 +376,150 @@ public static unsafe class World
             Marshal.FreeCoTaskMem(ignorePtr);
         }
     }
+
+    // Cast many rays in one native call (run in parallel on the server): hits[i] answers queries[i] exactly
+    // as World.raycast would, and a miss leaves hits[i] = default (objectUuid null). hits must be at least
+    // as long as queries. Returns how many rays hit. Prefer this over a loop of raycasts whenever a script
+    // casts more than a few per tick (e.g. line of sight for every agent).
+    public static int raycastBatch(ReadOnlySpan<RaycastQuery> queries, Span<RaycastHit> hits)
+    {
+        if (hits.Length < queries.Length)
+        {
+            throw new ArgumentException("hits must be at least as long as queries", nameof(hits));
+        }
+
+        if (queries.Length == 0)
+        {
+            return 0;
+        }
+
+        var nativeQueries = new RaycastQueryData[queries.Length];
+        for (var i = 0; i < queries.Length; ++i)
+        {
+            ref readonly var query = ref queries[i];
+            ref var native = ref nativeQueries[i];
+            native.ox = query.origin.X;
+            native.oy = query.origin.Y;
+            native.oz = query.origin.Z;
+            native.dx = query.direction.X;
+            native.dy = query.direction.Y;
+            native.dz = query.direction.Z;
+            native.maxDistance = query.maxDistance;
+            native.layerMask = query.layerMask;
+            fixed (byte* ignore = native.ignoreUuid)
+            {
+                writeUuid(query.ignoreUuid, ignore);
+            }
+        }
+
+        var nativeHits = new RaycastHitData[queries.Length];
+        fixed (RaycastQueryData* queriesPtr = nativeQueries)
+        fixed (RaycastHitData* hitsPtr = nativeHits)
+        {
+            NativeBindings.World.raycastBatch(queriesPtr, (uint)queries.Length, hitsPtr);
+        }
+
+        var hitCount = 0;
+        for (var i = 0; i < queries.Length; ++i)
+        {
+            ref var native = ref nativeHits[i];
+            if (native.hit == 0)
+            {
+                hits[i] = default;
+                continue;
+            }
+
+            ++hitCount;
+            fixed (byte* uuid = native.objectUuid)
+            {
+                hits[i] = new RaycastHit
+                {
+                    objectUuid = readUuid(uuid),
+                    distance = native.distance,
+                    point = new Vector3(native.px, native.py, native.pz),
+                    normal = new Vector3(native.nx, native.ny, native.nz)
+                };
+            }
+        }
+
+        return hitCount;
+    }
+
+    // Run many sphere overlaps in one native call (in parallel on the server). Element i holds the uuids
+    // World.overlapSphere would return for queries[i].
+    public static string[][] overlapSphereBatch(ReadOnlySpan<OverlapSphereQuery> queries)
+    {
+        if (queries.Length == 0)
+        {
+            return Array.Empty<string[]>();
+        }
+
+        var nativeQueries = new OverlapSphereQueryData[queries.Length];
+        for (var i = 0; i < queries.Length; ++i)
+        {
+            ref readonly var query = ref queries[i];
+            ref var native = ref nativeQueries[i];
+            native.cx = query.center.X;
+            native.cy = query.center.Y;
+            native.cz = query.center.Z;
+            native.radius = query.radius;
+            native.layerMask = query.layerMask;
+            fixed (byte* ignore = native.ignoreUuid)
+            {
+                writeUuid(query.ignoreUuid, ignore);
+            }
+        }
+
+        var counts = new uint[queries.Length];
+        var results = new string[queries.Length][];
+
+        fixed (OverlapSphereQueryData* queriesPtr = nativeQueries)
+        fixed (uint* countsPtr = counts)
+        {
+            // The uuids come back concatenated in query order, in a native thread-local buffer: read them
+            // out before any other World call (return ownership is native's).
+            var uuids = NativeBindings.World.overlapSphereBatch(queriesPtr, (uint)queries.Length, countsPtr);
+
+            for (var i = 0; i < queries.Length; ++i)
+            {
+                results[i] = new string[counts[i]];
+                for (var j = 0; j < counts[i]; ++j)
+                {
+                    results[i][j] = readUuid(uuids);
+                    uuids += 16;
+                }
+            }
+        }
+
+        return results;
+    }
+
+    // Raw 16 uuid bytes <-> the canonical lowercase 8-4-4-4-12 form every other World call uses.
+    private static string readUuid(byte* bytes)
+    {
+        var hex = Convert.ToHexString(new ReadOnlySpan<byte>(bytes, 16)).ToLowerInvariant();
+        return $"{hex[..8]}-{hex[8..12]}-{hex[12..16]}-{hex[16..20]}-{hex[20..]}";
+    }
+
+    // An empty or malformed uuid writes all zero, which the native side reads as "ignore nothing".
+    private static void writeUuid(string uuid, byte* bytes)
+    {
+        var destination = new Span<byte>(bytes, 16);
+        destination.Clear();
+
+        var hex = (uuid ?? "").Replace("-", "");
+        if (hex.Length != 32)
+        {
+            return;
+        }
+
+        try
+        {
+            Convert.FromHexString(hex).CopyTo(destination);
+        }
+        catch (FormatException)
+        {
+            destination.Clear();
+        }
+    }
 }
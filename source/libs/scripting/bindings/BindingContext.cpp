@@ -7,6 +7,10 @@ std::vector<std::shared_ptr<Object>> BindingContext::s_spawned;
 std::vector<uuids::uuid> BindingContext::s_destroyed;
 BindingContext::RaycastFn BindingContext::s_raycast = nullptr;
 BindingContext::OverlapSphereFn BindingContext::s_overlapSphere = nullptr;
+BindingContext::SphereCastFn BindingContext::s_sphereCast = nullptr;
+BindingContext::BoxCastFn BindingContext::s_boxCast = nullptr;
+BindingContext::RaycastBatchFn BindingContext::s_raycastBatch = nullptr;
+BindingContext::OverlapSphereBatchFn BindingContext::s_overlapSphereBatch = nullptr;
 
 void BindingContext::setObjectManager(ObjectManager* objectManager)
 {
@@ -67,3 +71,43 @@ BindingContext::OverlapSphereFn BindingContext::getOverlapSphere()
 {
   return s_overlapSphere;
 }
+
+void BindingContext::setSphereCast(const SphereCastFn sphereCast)
+{
+  s_sphereCast = sphereCast;
+}
+
+BindingContext::SphereCastFn BindingContext::getSphereCast()
+{
+  return s_sphereCast;
+}
+
+void BindingContext::setBoxCast(const BoxCastFn boxCast)
+{
+  s_boxCast = boxCast;
+}
+
+BindingContext::BoxCastFn BindingContext::getBoxCast()
+{
+  return s_boxCast;
+}
+
+void BindingContext::setRaycastBatch(const RaycastBatchFn raycastBatch)
+{
+  s_raycastBatch = raycastBatch;
+}
+
+BindingContext::RaycastBatchFn BindingContext::getRaycastBatch()
+{
+  return s_raycastBatch;
+}
+
+void BindingContext::setOverlapSphereBatch(const OverlapSphereBatchFn overlapSphereBatch)
+{
+  s_overlapSphereBatch = overlapSphereBatch;
+}
+
+BindingContext::OverlapSphereBatchFn BindingContext::getOverlapSphereBatch()
+{
+  return s_overlapSphereBatch;
+}
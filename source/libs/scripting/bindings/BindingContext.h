@@ -1,6 +1,7 @@
 #ifndef BINDINGCONTEXT_H
 #define BINDINGCONTEXT_H
 
+#include <queries/SceneQueryTypes.h>
 #include <glm/vec3.hpp>
 #include <cstdint>
 #include <memory>
@@ -18,7 +19,7 @@ class ObjectManager;
 // layer), so the spawn/destroy bindings record what happened here; ServerApp drains these after the tick
 // and replicates them (objectSpawned/objectDestroyed) - keeping scripting independent of net/protocol.
 //
-// Scene queries (raycast/overlap) live in sim, which scripting can't link, so the server app injects them
+// Scene queries (raycast/overlap/shape casts) live in sim, which scripting can't link, so the server app injects them
 // here as function pointers at startup (see SceneQueries); the World bindings call through them. Signatures
 // use only types both sides share (data + glm + uuid) and must match SceneQueries' statics.
 //
@@ -30,6 +31,13 @@ public:
                             const uuids::uuid&, uuids::uuid&, glm::vec3&, glm::vec3&, float&);
   using OverlapSphereFn = void(*)(ObjectManager&, const glm::vec3&, float, uint32_t,
                                   const uuids::uuid&, std::vector<uuids::uuid>&);
+  using SphereCastFn = bool(*)(ObjectManager&, const glm::vec3&, float, const glm::vec3&, float, uint32_t,
+                               const uuids::uuid&, uuids::uuid&, glm::vec3&, glm::vec3&, float&);
+  using BoxCastFn = bool(*)(ObjectManager&, const glm::vec3&, const glm::vec3&, const glm::vec3&, const glm::vec3&,
+                            float, uint32_t, const uuids::uuid&, uuids::uuid&, glm::vec3&, glm::vec3&, float&);
+  using RaycastBatchFn = void(*)(ObjectManager&, const std::vector<RaycastQuery>&, std::vector<RaycastResult>&);
+  using OverlapSphereBatchFn = void(*)(ObjectManager&, const std::vector<OverlapSphereQuery>&,
+                                       std::vector<std::vector<uuids::uuid>>&);
 
   static void setObjectManager(ObjectManager* objectManager);
 
@@ -54,6 +62,18 @@ public:
   static void setOverlapSphere(OverlapSphereFn overlapSphere);
   [[nodiscard]] static OverlapSphereFn getOverlapSphere();
 
+  static void setSphereCast(SphereCastFn sphereCast);
+  [[nodiscard]] static SphereCastFn getSphereCast();
+
+  static void setBoxCast(BoxCastFn boxCast);
+  [[nodiscard]] static BoxCastFn getBoxCast();
+
+  static void setRaycastBatch(RaycastBatchFn raycastBatch);
+  [[nodiscard]] static RaycastBatchFn getRaycastBatch();
+
+  static void setOverlapSphereBatch(OverlapSphereBatchFn overlapSphereBatch);
+  [[nodiscard]] static OverlapSphereBatchFn getOverlapSphereBatch();
+
 private:
   static ObjectManager* s_objectManager;
   static AssetRegistry* s_assetRegistry;
@@ -63,6 +83,10 @@ private:
 
   static RaycastFn s_raycast;
   static OverlapSphereFn s_overlapSphere;
+  static SphereCastFn s_sphereCast;
+  static BoxCastFn s_boxCast;
+  static RaycastBatchFn s_raycastBatch;
+  static OverlapSphereBatchFn s_overlapSphereBatch;
 };
 
 
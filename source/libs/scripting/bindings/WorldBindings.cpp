@@ -7,8 +7,10 @@
 #include <objects/components/Transform.h>
 #include <glm/vec3.hpp>
 #include <nlohmann/json.hpp>
+#include <cstring>
 #include <exception>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
@@ -20,12 +22,30 @@ namespace {
   // result to a C# string immediately (see World.cs) before the next binding call overwrites it.
   thread_local std::string s_returnBuffer;
 
+  // The overlapSphereBatch return buffer, under the same rule.
+  thread_local std::vector<uint8_t> s_uuidBuffer;
+
   const char* store(std::string value)
   {
     s_returnBuffer = std::move(value);
     return s_returnBuffer.c_str();
   }
 
+  // "uuid,dist,px,py,pz,nx,ny,nz" - uuids have no commas, so this parses cleanly on the managed side.
+  const char* storeHit(const uuids::uuid& hitObject, const glm::vec3& hitPoint, const glm::vec3& hitNormal,
+                       const float hitDistance)
+  {
+    std::string result = uuids::to_string(hitObject);
+    for (const float value : { hitDistance, hitPoint.x, hitPoint.y, hitPoint.z,
+                               hitNormal.x, hitNormal.y, hitNormal.z })
+    {
+      result += ',';
+      result += std::to_string(value);
+    }
+
+    return store(result);
+  }
+
   // Parse an optional uuid argument; an empty/invalid string becomes the nil uuid, which the query
   // treats as "ignore nothing" (real object uuids are never nil).
   uuids::uuid parseIgnore(const char* uuid)
@@ -38,6 +58,17 @@ namespace {
     return uuids::uuid::from_string(std::string(uuid)).value_or(uuids::uuid{});
   }
 
+  // A raw 16-byte uuid from a batch record; all zero is the nil uuid ("ignore nothing").
+  uuids::uuid uuidFromBytes(const uint8_t (&bytes)[16])
+  {
+    return uuids::uuid(std::begin(bytes), std::end(bytes));
+  }
+
+  void uuidToBytes(const uuids::uuid& uuid, uint8_t* bytes)
+  {
+    std::memcpy(bytes, uuid.as_bytes().data(), 16);
+  }
+
   // Object::start() covers only its own components; a prefab instance is a whole subtree, and every node
   // needs live component state before physics/replication read it.
   void startSubtree(const Object& object)
@@ -62,7 +93,11 @@ WorldBindings WorldBindingsProvider::getBindings()
     .destroyObject = &bindDestroyObject,
     .raycast = &bindRaycast,
     .overlapSphere = &bindOverlapSphere,
-    .spawnPrefab = &bindSpawnPrefab
+    .spawnPrefab = &bindSpawnPrefab,
+    .raycastBatch = &bindRaycastBatch,
+    .overlapSphereBatch = &bindOverlapSphereBatch,
+    .sphereCast = &bindSphereCast,
+    .boxCast = &bindBoxCast
   };
 }
 
@@ -275,16 +310,7 @@ const char* WorldBindingsProvider::bindRaycast(const float ox, const float oy, c
     return store("");
   }
 
-  // "uuid,dist,px,py,pz,nx,ny,nz" - uuids have no commas, so this parses cleanly on the managed side.
-  std::string result = uuids::to_string(hitObject);
-  for (const float value : { hitDistance, hitPoint.x, hitPoint.y, hitPoint.z,
-                             hitNormal.x, hitNormal.y, hitNormal.z })
-  {
-    result += ',';
-    result += std::to_string(value);
-  }
-
-  return store(result);
+  return storeHit(hitObject, hitPoint, hitNormal, hitDistance);
 }
 
 const char* WorldBindingsProvider::bindOverlapSphere(const float cx, const float cy, const float cz,
@@ -313,3 +339,159 @@ const char* WorldBindingsProvider::bindOverlapSphere(const float cx, const float
 
   return store(out);
 }
+
+const char* WorldBindingsProvider::bindSphereCast(const float ox, const float oy, const float oz, const float radius,
+                                                  const float dx, const float dy, const float dz,
+                                                  const float maxDistance, const uint32_t layerMask,
+                                                  const char* ignoreUuid)
+{
+  const auto objectManager = BindingContext::getObjectManager();
+  const auto sphereCast = BindingContext::getSphereCast();
+  if (!objectManager || !sphereCast)
+  {
+    return store("");
+  }
+
+  uuids::uuid hitObject;
+  glm::vec3 hitPoint(0.0f);
+  glm::vec3 hitNormal(0.0f);
+  float hitDistance = 0.0f;
+
+  if (!sphereCast(*objectManager, { ox, oy, oz }, radius, { dx, dy, dz }, maxDistance, layerMask,
+                  parseIgnore(ignoreUuid), hitObject, hitPoint, hitNormal, hitDistance))
+  {
+    return store("");
+  }
+
+  return storeHit(hitObject, hitPoint, hitNormal, hitDistance);
+}
+
+const char* WorldBindingsProvider::bindBoxCast(const float cx, const float cy, const float cz,
+                                               const float hx, const float hy, const float hz,
+                                               const float rx, const float ry, const float rz,
+                                               const float dx, const float dy, const float dz,
+                                               const float maxDistance, const uint32_t layerMask,
+                                               const char* ignoreUuid)
+{
+  const auto objectManager = BindingContext::getObjectManager();
+  const auto boxCast = BindingContext::getBoxCast();
+  if (!objectManager || !boxCast)
+  {
+    return store("");
+  }
+
+  uuids::uuid hitObject;
+  glm::vec3 hitPoint(0.0f);
+  glm::vec3 hitNormal(0.0f);
+  float hitDistance = 0.0f;
+
+  if (!boxCast(*objectManager, { cx, cy, cz }, { hx, hy, hz }, { rx, ry, rz }, { dx, dy, dz }, maxDistance,
+               layerMask, parseIgnore(ignoreUuid), hitObject, hitPoint, hitNormal, hitDistance))
+  {
+    return store("");
+  }
+
+  return storeHit(hitObject, hitPoint, hitNormal, hitDistance);
+}
+
+void WorldBindingsProvider::bindRaycastBatch(const RaycastQueryData* queries, const uint32_t count, RaycastHitData* hits)
+{
+  if (!hits || count == 0)
+  {
+    return;
+  }
+
+  std::memset(hits, 0, sizeof(RaycastHitData) * count);
+
+  const auto objectManager = BindingContext::getObjectManager();
+  const auto raycastBatch = BindingContext::getRaycastBatch();
+  if (!objectManager || !raycastBatch || !queries)
+  {
+    return;
+  }
+
+  std::vector<RaycastQuery> batch(count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const auto& query = queries[i];
+    batch[i] = {
+      .origin = { query.ox, query.oy, query.oz },
+      .direction = { query.dx, query.dy, query.dz },
+      .maxDistance = query.maxDistance,
+      .layerMask = query.layerMask,
+      .ignoreObject = uuidFromBytes(query.ignoreUuid)
+    };
+  }
+
+  std::vector<RaycastResult> results;
+  raycastBatch(*objectManager, batch, results);
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const auto& result = results[i];
+    if (!result.hit)
+    {
+      continue;
+    }
+
+    auto& hit = hits[i];
+    hit.hit = 1;
+    uuidToBytes(result.object, hit.objectUuid);
+    hit.distance = result.distance;
+    hit.px = result.point.x;
+    hit.py = result.point.y;
+    hit.pz = result.point.z;
+    hit.nx = result.normal.x;
+    hit.ny = result.normal.y;
+    hit.nz = result.normal.z;
+  }
+}
+
+const uint8_t* WorldBindingsProvider::bindOverlapSphereBatch(const OverlapSphereQueryData* queries, const uint32_t count,
+                                                             uint32_t* resultCounts)
+{
+  s_uuidBuffer.clear();
+
+  if (!resultCounts || count == 0)
+  {
+    return s_uuidBuffer.data();
+  }
+
+  std::memset(resultCounts, 0, sizeof(uint32_t) * count);
+
+  const auto objectManager = BindingContext::getObjectManager();
+  const auto overlapSphereBatch = BindingContext::getOverlapSphereBatch();
+  if (!objectManager || !overlapSphereBatch || !queries)
+  {
+    return s_uuidBuffer.data();
+  }
+
+  std::vector<OverlapSphereQuery> batch(count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const auto& query = queries[i];
+    batch[i] = {
+      .center = { query.cx, query.cy, query.cz },
+      .radius = query.radius,
+      .layerMask = query.layerMask,
+      .ignoreObject = uuidFromBytes(query.ignoreUuid)
+    };
+  }
+
+  std::vector<std::vector<uuids::uuid>> results;
+  overlapSphereBatch(*objectManager, batch, results);
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    resultCounts[i] = static_cast<uint32_t>(results[i].size());
+
+    for (const auto& uuid : results[i])
+    {
+      const auto offset = s_uuidBuffer.size();
+      s_uuidBuffer.resize(offset + 16);
+      uuidToBytes(uuid, s_uuidBuffer.data() + offset);
+    }
+  }
+
+  return s_uuidBuffer.data();
+}
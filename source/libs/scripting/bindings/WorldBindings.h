@@ -9,6 +9,36 @@
 //
 // String returns point into a thread-local buffer owned by the native side; the managed caller marshals
 // them out immediately (see World.cs) and must not free them. String arguments are owned by the caller.
+
+// Batch query records, mirrored field-for-field by World.cs (sequential layout, every field 4-byte sized or
+// a byte array, so no padding differs between the sides). Uuids travel as their 16 raw bytes (all zero =
+// none) instead of strings, so a batch crosses the boundary without per-entry formatting or parsing.
+struct RaycastQueryData
+{
+  float ox, oy, oz;
+  float dx, dy, dz;
+  float maxDistance;
+  uint32_t layerMask;
+  uint8_t ignoreUuid[16];
+};
+
+struct RaycastHitData
+{
+  uint32_t hit;
+  uint8_t objectUuid[16];
+  float distance;
+  float px, py, pz;
+  float nx, ny, nz;
+};
+
+struct OverlapSphereQueryData
+{
+  float cx, cy, cz;
+  float radius;
+  uint32_t layerMask;
+  uint8_t ignoreUuid[16];
+};
+
 struct WorldBindings
 {
   const char*(*findObjectByName)(const char* name);
@@ -22,6 +52,12 @@ struct WorldBindings
   const char*(*overlapSphere)(float cx, float cy, float cz, float radius, uint32_t layerMask,
                               const char* ignoreUuid);
   const char*(*spawnPrefab)(const char* prefabUuid, float x, float y, float z);
+  void(*raycastBatch)(const RaycastQueryData* queries, uint32_t count, RaycastHitData* hits);
+  const uint8_t*(*overlapSphereBatch)(const OverlapSphereQueryData* queries, uint32_t count, uint32_t* resultCounts);
+  const char*(*sphereCast)(float ox, float oy, float oz, float radius, float dx, float dy, float dz,
+                           float maxDistance, uint32_t layerMask, const char* ignoreUuid);
+  const char*(*boxCast)(float cx, float cy, float cz, float hx, float hy, float hz, float rx, float ry, float rz,
+                        float dx, float dy, float dz, float maxDistance, uint32_t layerMask, const char* ignoreUuid);
 };
 
 class WorldBindingsProvider {
@@ -51,6 +87,22 @@ private:
                                  float maxDistance, uint32_t layerMask, const char* ignoreUuid);
   static const char* bindOverlapSphere(float cx, float cy, float cz, float radius, uint32_t layerMask,
                                        const char* ignoreUuid);
+
+  // Shape casts: same injection, and the same "uuid,dist,px,py,pz,nx,ny,nz" / "" return as raycast.
+  static const char* bindSphereCast(float ox, float oy, float oz, float radius, float dx, float dy, float dz,
+                                    float maxDistance, uint32_t layerMask, const char* ignoreUuid);
+  static const char* bindBoxCast(float cx, float cy, float cz, float hx, float hy, float hz,
+                                 float rx, float ry, float rz, float dx, float dy, float dz,
+                                 float maxDistance, uint32_t layerMask, const char* ignoreUuid);
+
+  // Batches: one managed->native transition for count queries, run through the injected batch query (in
+  // parallel on the sim side). raycastBatch fills the caller's hits array (hits[i] answers queries[i]).
+  // overlapSphereBatch writes each query's result count into the caller's resultCounts array and returns
+  // the concatenated 16-byte uuids of every result, in query order, in a thread-local buffer (same
+  // ownership rule as the string returns).
+  static void bindRaycastBatch(const RaycastQueryData* queries, uint32_t count, RaycastHitData* hits);
+  static const uint8_t* bindOverlapSphereBatch(const OverlapSphereQueryData* queries, uint32_t count,
+                                               uint32_t* resultCounts);
 };
 
 
@@ -3,86 +3,544 @@
 #include "collisions/Simplex.h"
 #include "collisions/Polytope.h"
 #include "collisions/Support.h"
+#include <JobSystem.h>
 #include <objects/Object.h>
 #include <objects/ObjectManager.h>
 #include <objects/components/Component.h>
 #include <objects/components/RigidBody.h>
+#include <objects/components/collisions/BoxCollider.h>
 #include <objects/components/collisions/Collider.h>
+#include <objects/components/collisions/CompoundCollider.h>
+#include <objects/components/collisions/ConvexHullCollider.h>
 #include <objects/components/collisions/SphereCollider.h>
 #include <glm/glm.hpp>
 #include <algorithm>
+#include <bit>
+#include <cmath>
 #include <iterator>
+#include <numeric>
+#include <span>
+#include <utility>
+
+namespace
+{
+  // Fill ranges (and the occupied-layer mask) for edges already grouped by ascending collider layer.
+  uint32_t findLayerRanges(const std::vector<CollisionEdge>& edges,
+                           std::array<uint32_t, PhysicsSettings::layerCount + 1>& ranges)
+  {
+    uint32_t occupied = 0;
+    uint32_t index = 0;
+    const auto count = static_cast<uint32_t>(edges.size());
+
+    for (uint32_t layer = 0; layer < PhysicsSettings::layerCount; ++layer)
+    {
+      ranges[layer] = index;
+      while (index < count && edges[index].collider->getLayer() == layer)
+      {
+        ++index;
+      }
+
+      if (index != ranges[layer])
+      {
+        occupied |= 1u << layer;
+      }
+    }
+    ranges[PhysicsSettings::layerCount] = index;
+
+    return occupied;
+  }
+
+  // One object owns or directly parents the other: never a contact (a body and its own child colliders).
+  bool related(const std::shared_ptr<Object>& a, const std::shared_ptr<Object>& b)
+  {
+    return a == b || a->getParent() == b || b->getParent() == a;
+  }
+
+  // The object, or an ancestor, has a RigidBody: a body's child colliders move with it.
+  bool movesUnderPhysics(std::shared_ptr<Object> object)
+  {
+    for (; object; object = object->getParent())
+    {
+      if (object->getComponent<RigidBody>(ComponentType::rigidBody))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // The world matrix maps the unit cube with no rotation (every off-diagonal term zero).
+  bool isAxisAligned(const glm::mat4& worldMatrix)
+  {
+    for (int column = 0; column < 3; ++column)
+    {
+      for (int row = 0; row < 3; ++row)
+      {
+        if (row != column && worldMatrix[column][row] != 0.0f)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // A query snapshot's world bounding box.
+  Aabb queryShapeBounds(const QueryShape& shape)
+  {
+    if (shape.type == ColliderType::sphereCollider)
+    {
+      return { shape.center - glm::vec3(shape.radius), shape.center + glm::vec3(shape.radius) };
+    }
+
+    const auto box = makeBoundingBox({ glm::vec3(shape.matrix[3]), glm::mat3(shape.matrix) });
+    return { { box.minX, box.minY, box.minZ }, { box.maxX, box.maxY, box.maxZ } };
+  }
+
+  // The shapes a collider is tested as: a compound's own shapes, or the collider itself.
+  std::span<const std::shared_ptr<Collider>> shapesOf(const std::shared_ptr<Collider>& collider)
+  {
+    if (collider->getColliderType() == ColliderType::compoundCollider)
+    {
+      return static_cast<const CompoundCollider&>(*collider).getShapes();
+    }
+
+    return { &collider, 1 };
+  }
+
+  // Bring the matrices a shape test reads lazily (a box's or hull's world matrix, a shape's transform
+  // pointer) up to date, so tests running in parallel afterwards only ever read them.
+  void refreshShapeCaches(const std::shared_ptr<Collider>& collider)
+  {
+    static_cast<void>(collider->getPosition());
+
+    for (const auto& shape : shapesOf(collider))
+    {
+      switch (shape->getColliderType())
+      {
+        case ColliderType::boxCollider:
+          static_cast<void>(static_cast<BoxCollider&>(*shape).getWorldMatrix());
+          break;
+
+        case ColliderType::convexHullCollider:
+          static_cast<void>(static_cast<ConvexHullCollider&>(*shape).getWorldMatrix());
+          break;
+
+        default:
+          static_cast<void>(shape->getPosition());
+          break;
+      }
+    }
+  }
+
+  bool sphereOverlapsBox(const glm::vec3& center, const float radius, BoxCollider& box)
+  {
+    // Closest point of the box to the centre: clamp in the box's local frame, then back to world.
+    const glm::vec3 local = glm::vec3(box.getInverseWorldMatrix() * glm::vec4(center, 1.0f));
+    const glm::vec3 closest = glm::vec3(box.getWorldMatrix() * glm::vec4(glm::clamp(local, -1.0f, 1.0f), 1.0f));
+    const glm::vec3 offset = closest - center;
+
+    return glm::dot(offset, offset) <= radius * radius;
+  }
+}
+
+template<typename Visitor>
+void CollisionSystem::queryDynamic(const Aabb& box, const uint32_t layers, Visitor&& visit) const
+{
+  for (uint32_t remaining = layers & m_occupiedLayers; remaining != 0u; remaining &= remaining - 1u)
+  {
+    const auto layer = static_cast<uint32_t>(std::countr_zero(remaining));
+
+    for (uint32_t j = m_layerBegin[layer]; j < m_layerBegin[layer + 1]; ++j)
+    {
+      if (m_collisionEdges[j].position > box.max.x)
+      {
+        break;
+      }
+
+      if (m_bounds.overlaps(j, box.min, box.max))
+      {
+        visit(j);
+      }
+    }
+  }
+}
+
+template<typename Visitor>
+void CollisionSystem::forEachCandidate(const size_t index, Visitor&& visit) const
+{
+  const auto& edge = m_collisionEdges[index];
+
+  // Boxes come from the pass's packed snapshot, never the live colliders, so bodies moved by other threads'
+  // responses mid-pass can't race a lazy bounding-box refresh.
+  const Aabb box{ m_bounds.min(index), m_bounds.max(index) };
+
+  // Only the layers the matrix pairs with this one are visited; the rest are never touched.
+  const uint32_t layers = m_layerMatrix[edge.collider->getLayer()];
+
+  // Layer/mask filter: skip pairs that don't share a collision layer before any narrow-phase or event
+  // work, so filtered layers produce neither a physical response nor a collision event.
+  const auto offer = [&](const CollisionEdge& other) {
+    if (!related(edge.object, other.object) && layersCollide(edge.collider, other.collider))
+    {
+      visit(other);
+    }
+  };
+
+  // Dynamic vs dynamic: sweep and prune along x, within each interacting layer.
+  queryDynamic(box, layers, [&](const uint32_t j) {
+    offer(m_collisionEdges[j]);
+  });
+
+  // Dynamic vs static: the interacting layers' static trees, which are never written during the pass.
+  queryStatic(box, layers, [&](const uint32_t staticIndex) {
+    offer(m_staticEdges[staticIndex]);
+  });
+}
 
 void CollisionSystem::fixedUpdate(const ObjectManager& objectManager)
+{
+  if (&objectManager != m_partitionObjectManager || objectManager.getStructureVersion() != m_partitionVersion ||
+      staticLayersChanged())
+  {
+    partition(objectManager);
+  }
+  else if (m_staticBounds.refresh(m_staticEdges) > 0)
+  {
+    // A static collider was moved by something other than physics; the tree's boxes no longer hold.
+    buildStaticTree();
+  }
+
+  m_bounds.refresh(m_collisionEdges);
+
+  checkCollisions();
+
+  // Collision response moved bodies; the trigger pass, the query tree (and next tick's continuous sweeps)
+  // want their final boxes.
+  m_bounds.refresh(m_collisionEdges);
+
+  checkTriggers();
+  recordCollisionEvents();
+
+  buildQueryTree(objectManager);
+}
+
+void CollisionSystem::partition(const ObjectManager& objectManager)
 {
   m_collisionEdges.clear();
+  m_staticEdges.clear();
 
   for (const auto& object : objectManager.getAllObjects())
   {
     if (const auto collider = object->getComponent<Collider>(ComponentType::collider))
     {
-      m_collisionEdges.push_back({ object, collider, 0.0f });
+      auto& edges = movesUnderPhysics(object) ? m_collisionEdges : m_staticEdges;
+      edges.push_back({ object, collider, 0.0f });
     }
   }
 
-  checkCollisions();
+  // Group the statics by layer once here, so each layer's tree covers one contiguous range.
+  std::ranges::stable_sort(m_staticEdges, {}, [](const CollisionEdge& edge) { return edge.collider->getLayer(); });
+  m_staticOccupiedLayers = findLayerRanges(m_staticEdges, m_staticLayerBegin);
+
+  m_staticBounds.refresh(m_staticEdges);
+  buildStaticTree();
+
+  m_partitionObjectManager = &objectManager;
+  m_partitionVersion = objectManager.getStructureVersion();
 }
 
-void CollisionSystem::checkCollisions()
+bool CollisionSystem::staticLayersChanged() const
 {
-  for (auto& edge : m_collisionEdges)
+  for (uint32_t layer = 0; layer < PhysicsSettings::layerCount; ++layer)
   {
-    edge.position = edge.collider->getBoundingBox().minX;
+    for (uint32_t i = m_staticLayerBegin[layer]; i < m_staticLayerBegin[layer + 1]; ++i)
+    {
+      if (m_staticEdges[i].collider->getLayer() != layer)
+      {
+        return true;
+      }
+    }
   }
 
-  std::ranges::sort(m_collisionEdges, [](const CollisionEdge& a, const CollisionEdge& b)
+  return false;
+}
+
+void CollisionSystem::buildStaticTree()
+{
+  m_staticShapes.clear();
+  m_staticShapes.reserve(m_staticEdges.size());
+  m_staticShapeBegin.clear();
+  m_staticShapeBegin.reserve(m_staticEdges.size() + 1);
+
+  for (const auto& edge : m_staticEdges)
   {
-    return a.position < b.position;
-  });
+    m_staticShapeBegin.push_back(static_cast<uint32_t>(m_staticShapes.size()));
+    appendQueryShapes(*edge.object, edge.collider, m_staticShapes);
+  }
+  m_staticShapeBegin.push_back(static_cast<uint32_t>(m_staticShapes.size()));
 
-  // Each edge's collided objects, indexed by edge so the parallel loop can record them lock-free (every
-  // thread writes only its own slot). Drained serially into the pair set once the loop finishes.
-  std::vector<std::vector<std::shared_ptr<Object>>> perEdgeCollisions(m_collisionEdges.size());
+  std::vector<Aabb> boxes;
+  for (uint32_t layer = 0; layer < PhysicsSettings::layerCount; ++layer)
+  {
+    boxes.clear();
+    for (uint32_t i = m_staticLayerBegin[layer]; i < m_staticLayerBegin[layer + 1]; ++i)
+    {
+      boxes.push_back({ m_staticBounds.min(i), m_staticBounds.max(i) });
+    }
+
+    m_staticTrees[layer].build(boxes);
+  }
+}
+
+void CollisionSystem::buildQueryTree(const ObjectManager& objectManager)
+{
+  m_queryShapes.clear();
 
-#pragma omp parallel for default(none) shared(perEdgeCollisions) num_threads(6)
-  for (int i = 0; i < m_collisionEdges.size(); ++i)
+  std::vector<Aabb> boxes;
+  boxes.reserve(m_collisionEdges.size());
+
+  for (size_t i = 0; i < m_collisionEdges.size(); ++i)
   {
     const auto& edge = m_collisionEdges[i];
 
-    auto rigidBody = edge.object->getComponent<RigidBody>(ComponentType::rigidBody);
+    const size_t first = m_queryShapes.size();
+    appendQueryShapes(*edge.object, edge.collider, m_queryShapes);
 
-    if (!rigidBody)
+    // A compound's shapes each get their own box rather than the compound's combined one, so a query
+    // passing through the gap between a table's legs doesn't test them all.
+    if (edge.collider->getColliderType() == ColliderType::compoundCollider)
     {
+      for (size_t shape = first; shape < m_queryShapes.size(); ++shape)
+      {
+        boxes.push_back(queryShapeBounds(m_queryShapes[shape]));
+      }
       continue;
     }
 
-    std::vector<std::shared_ptr<Object>> collidedObjects;
-    findCollisions(edge, collidedObjects);
+    for (size_t shape = first; shape < m_queryShapes.size(); ++shape)
+    {
+      boxes.push_back({ m_bounds.min(i), m_bounds.max(i) });
+    }
+  }
 
-    if (!collidedObjects.empty())
+  m_queryTree.build(boxes);
+  m_queryObjectManager = &objectManager;
+}
+
+void CollisionSystem::setDeterministic(const bool deterministic)
+{
+  m_deterministic = deterministic;
+}
+
+void CollisionSystem::setLayerMatrix(const std::array<uint32_t, PhysicsSettings::layerCount>& layerMatrix)
+{
+  // The pair loop visits only from one side, so a pair must be allowed by both rows to interact.
+  for (uint32_t a = 0; a < PhysicsSettings::layerCount; ++a)
+  {
+    uint32_t row = 0;
+    for (uint32_t b = 0; b < PhysicsSettings::layerCount; ++b)
     {
-      handleCollisions(rigidBody, edge.collider, collidedObjects);
-      perEdgeCollisions[i] = std::move(collidedObjects);
+      if ((layerMatrix[a] & (1u << b)) != 0u && (layerMatrix[b] & (1u << a)) != 0u)
+      {
+        row |= 1u << b;
+      }
     }
+
+    m_layerMatrix[a] = row;
+  }
+}
+
+void CollisionSystem::checkCollisions()
+{
+  std::vector<uint32_t> order(m_collisionEdges.size());
+  std::iota(order.begin(), order.end(), 0u);
+
+  // Grouped by layer, then swept along x within each layer.
+  const auto byLayerThenMinX = [this](const uint32_t a, const uint32_t b)
+  {
+    const uint32_t layerA = m_collisionEdges[a].collider->getLayer();
+    const uint32_t layerB = m_collisionEdges[b].collider->getLayer();
+
+    return layerA != layerB ? layerA < layerB : m_bounds.minX(a) < m_bounds.minX(b);
+  };
+
+  // Edges are gathered in scene order and the last pass's order is kept, so a stable sort breaks minX ties
+  // the same way every run.
+  if (m_deterministic)
+  {
+    std::ranges::stable_sort(order, byLayerThenMinX);
   }
+  else
+  {
+    std::ranges::sort(order, byLayerThenMinX);
+  }
+
+  // Reorder the edges and their packed boxes together, so slot i of the bounds stays edge i's box and the
+  // sweep below walks both front to back.
+  std::vector<CollisionEdge> sorted;
+  sorted.reserve(order.size());
+  for (const uint32_t index : order)
+  {
+    sorted.push_back(std::move(m_collisionEdges[index]));
+  }
+  m_collisionEdges = std::move(sorted);
+  m_bounds.permute(order);
+
+  for (size_t i = 0; i < m_collisionEdges.size(); ++i)
+  {
+    m_collisionEdges[i].position = m_bounds.minX(i);
+  }
+
+  m_occupiedLayers = findLayerRanges(m_collisionEdges, m_layerBegin);
+
+  // Each edge's collided objects, indexed by edge so the parallel loop can record them lock-free (every
+  // thread writes only its own slot). Drained serially into the pair set once the passes finish.
+  m_edgeContacts.assign(m_collisionEdges.size(), {});
 
-  recordCollisionEvents(perEdgeCollisions);
+  // handleCollisions writes both bodies of a dynamic pair, so a parallel pass resolves shared bodies in
+  // thread order. Deterministic mode runs the loop as a single chunk instead: serially, in edge order.
+  constexpr size_t edgesPerChunk = 16;
+  const size_t edgeCount = m_collisionEdges.size();
+  const size_t grain = m_deterministic ? edgeCount : edgesPerChunk;
+
+  JobSystem::parallelFor("collision.pairs", edgeCount, grain, [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      const auto& edge = m_collisionEdges[i];
+
+      auto rigidBody = edge.object->getComponent<RigidBody>(ComponentType::rigidBody);
+
+      if (!rigidBody)
+      {
+        continue;
+      }
+
+      std::vector<std::shared_ptr<Object>> collidedObjects;
+      findCollisions(i, collidedObjects);
+
+      if (!collidedObjects.empty())
+      {
+        handleCollisions(rigidBody, edge.collider, collidedObjects);
+        m_edgeContacts[i] = std::move(collidedObjects);
+      }
+    }
+  });
 }
 
-void CollisionSystem::recordCollisionEvents(const std::vector<std::vector<std::shared_ptr<Object>>>& perEdgeCollisions)
+void CollisionSystem::checkTriggers()
 {
-  // Flatten the per-edge results into this tick's canonical pair set. A dynamic-vs-dynamic contact is
-  // detected from both sides, so canonicalize (a < b) and dedupe.
-  std::vector<CollisionPair> current;
-  for (size_t i = 0; i < perEdgeCollisions.size(); ++i)
+  // A trigger is either a dynamic edge (which can meet dynamic and static colliders) or a static one (which
+  // only dynamic colliders can reach: static pairs are never tested).
+  struct TriggerRef {
+    uint32_t index;
+    bool isStatic;
+  };
+
+  std::vector<TriggerRef> triggers;
+  for (uint32_t i = 0; i < m_collisionEdges.size(); ++i)
+  {
+    if (m_collisionEdges[i].collider->isTrigger())
+    {
+      triggers.push_back({ i, false });
+    }
+  }
+  for (uint32_t i = 0; i < m_staticEdges.size(); ++i)
+  {
+    if (m_staticEdges[i].collider->isTrigger())
+    {
+      triggers.push_back({ i, true });
+    }
+  }
+
+  if (triggers.empty())
+  {
+    m_triggerPairs.clear();
+    return;
+  }
+
+  // The shape tests refresh colliders' cached matrices lazily, so refresh every collider a trigger can
+  // meet here first: a dynamic trigger meets both sets, a static one the dynamic set. After that the
+  // tests only read shared state and write each trigger's own slot, so the pairs come out the same in
+  // either mode.
+  for (const auto& edge : m_collisionEdges)
+  {
+    refreshShapeCaches(edge.collider);
+  }
+  for (const auto& edge : m_staticEdges)
+  {
+    refreshShapeCaches(edge.collider);
+  }
+
+  std::vector<std::vector<CollisionPair>> perTrigger(triggers.size());
+
+  constexpr size_t triggersPerChunk = 32;
+
+  JobSystem::parallelFor("collision.triggers", triggers.size(), triggersPerChunk, [&](const size_t begin, const size_t end) {
+    for (size_t t = begin; t < end; ++t)
+    {
+      const auto [index, isStatic] = triggers[t];
+      auto& pairs = perTrigger[t];
+
+      if (!isStatic)
+      {
+        const auto& edge = m_collisionEdges[index];
+
+        forEachCandidate(index, [&](const CollisionEdge& other) {
+          if (triggerOverlaps(edge.collider, other.collider))
+          {
+            pairs.push_back(CollisionPair::make(edge.object->getUUID(), other.object->getUUID()));
+          }
+        });
+        continue;
+      }
+
+      const auto& edge = m_staticEdges[index];
+      const Aabb box{ m_staticBounds.min(index), m_staticBounds.max(index) };
+
+      queryDynamic(box, m_layerMatrix[edge.collider->getLayer()], [&](const uint32_t j) {
+        const auto& other = m_collisionEdges[j];
+
+        if (!related(edge.object, other.object) && layersCollide(edge.collider, other.collider) &&
+            triggerOverlaps(edge.collider, other.collider))
+        {
+          pairs.push_back(CollisionPair::make(edge.object->getUUID(), other.object->getUUID()));
+        }
+      });
+    }
+  });
+
+  m_triggerPairs.clear();
+  for (const auto& pairs : perTrigger)
+  {
+    m_triggerPairs.insert(m_triggerPairs.end(), pairs.begin(), pairs.end());
+  }
+}
+
+void CollisionSystem::recordCollisionEvents()
+{
+  // Flatten the per-edge results and the trigger overlaps into the tick's pair set. Sorting waits for
+  // commitEvents(), which sees every step of the tick at once.
+  m_tickPairs.insert(m_tickPairs.end(), m_triggerPairs.begin(), m_triggerPairs.end());
+  for (size_t i = 0; i < m_edgeContacts.size(); ++i)
   {
     const auto& selfUUID = m_collisionEdges[i].object->getUUID();
 
-    for (const auto& other : perEdgeCollisions[i])
+    for (const auto& other : m_edgeContacts[i])
     {
-      current.push_back(CollisionPair::make(selfUUID, other->getUUID()));
+      m_tickPairs.push_back(CollisionPair::make(selfUUID, other->getUUID()));
     }
   }
+}
+
+void CollisionSystem::commitEvents()
+{
+  // A dynamic-vs-dynamic contact (or a pair of triggers) is detected from both sides, and a lasting
+  // contact once per substep, so canonicalize (a < b) and dedupe.
+  std::vector<CollisionPair> current = std::move(m_tickPairs);
+  m_tickPairs.clear();
 
   std::ranges::sort(current);
   current.erase(std::unique(current.begin(), current.end()), current.end());
@@ -100,54 +558,188 @@ void CollisionSystem::recordCollisionEvents(const std::vector<std::vector<std::s
   m_previousPairs = std::move(current);
 }
 
-void CollisionSystem::reset()
+float CollisionSystem::timeOfImpact(const std::shared_ptr<Object>& object, const std::shared_ptr<Collider>& collider,
+                                    const glm::vec3& displacement) const
 {
-  m_previousPairs.clear();
-  m_enters.clear();
-  m_stays.clear();
-  m_exits.clear();
-}
+  const auto bbox = collider->getBoundingBox();
 
-void CollisionSystem::findCollisions(const CollisionEdge& edge, std::vector<std::shared_ptr<Object>>& collidedObjects) const
-{
-  const auto bbox = edge.collider->getBoundingBox();
+  // The largest step that can't jump over anything: half the mover's thinnest extent. A move shorter than
+  // that is left to the discrete pass, which already catches it.
+  const float minHalfExtent = 0.5f * std::min({ bbox.maxX - bbox.minX, bbox.maxY - bbox.minY, bbox.maxZ - bbox.minZ });
+  const float distance = glm::length(displacement);
 
-  for (const auto& other : m_collisionEdges)
+  if (minHalfExtent <= 0.0f || distance <= minHalfExtent)
   {
-    if (other.object == edge.object ||
-        other.object->getParent() == edge.object ||
-        other.object == edge.object->getParent())
+    return 1.0f;
+  }
+
+  const glm::vec3 startMin(bbox.minX, bbox.minY, bbox.minZ);
+  const glm::vec3 startMax(bbox.maxX, bbox.maxY, bbox.maxZ);
+
+  // Swept bounds: the box at the start of the move unioned with the box at the end.
+  const glm::vec3 sweptMin = glm::min(startMin, startMin + displacement);
+  const glm::vec3 sweptMax = glm::max(startMax, startMax + displacement);
+
+  // The fraction of the move one step covers.
+  const float stepFraction = minHalfExtent / distance;
+
+  // The mover's own body: its other colliders move with it, so they're never in the way.
+  const auto body = object->getComponent<RigidBody>(ComponentType::rigidBody);
+
+  float earliest = 1.0f;
+
+  // Candidates that passed the bounds test; pulls earliest in if the sweep hits other.
+  const auto sweepAgainst = [&](const CollisionEdge& other, const Aabb& otherBox) {
+    if (related(object, other.object) ||
+        (body && other.object->getComponent<RigidBody>(ComponentType::rigidBody) == body) ||
+        other.collider->isTrigger() ||
+        !layersCollide(collider, other.collider))
     {
-      continue;
+      return;
     }
 
-    if (other.position > bbox.maxX)
+    // The part of the move where the moving box overlaps other's (per axis, then intersected). Only that
+    // stretch needs stepping, so a long move costs steps in proportion to what it crosses, not to its length.
+    float enter = 0.0f;
+    float exit = 1.0f;
+    for (int axis = 0; axis < 3; ++axis)
     {
-      break;
+      if (displacement[axis] == 0.0f)
+      {
+        if (startMax[axis] < otherBox.min[axis] || startMin[axis] > otherBox.max[axis])
+        {
+          return;
+        }
+
+        continue;
+      }
+
+      const float toNear = (otherBox.min[axis] - startMax[axis]) / displacement[axis];
+      const float toFar = (otherBox.max[axis] - startMin[axis]) / displacement[axis];
+      enter = std::max(enter, std::min(toNear, toFar));
+      exit = std::min(exit, std::max(toNear, toFar));
     }
 
-    // Layer/mask filter: skip pairs that don't share a collision layer before any narrow-phase or event
-    // work, so filtered layers produce neither a physical response nor a collision event. Kept after the
-    // sweep-and-prune break so the early-out still fires for beyond-range colliders on any layer.
-    if (!layersCollide(edge.collider, other.collider))
+    if (enter > exit || enter > earliest)
     {
-      continue;
+      return;
     }
 
-    const auto otherBbox = other.collider->getBoundingBox();
+    if (shapesIntersect(collider, other.collider, glm::vec3(0)))
+    {
+      // Already touching at the start of the move: the discrete pass resolves it.
+      return;
+    }
 
-    if (bbox.maxX < otherBbox.minX || bbox.minX > otherBbox.maxX ||
-        bbox.maxY < otherBbox.minY || bbox.minY > otherBbox.maxY ||
-        bbox.maxZ < otherBbox.minZ || bbox.minZ > otherBbox.maxZ)
+    // March across the overlap (only up to the best hit so far) until the first overlapping sample. The
+    // boxes are apart before enter, so the shapes are too.
+    const int steps = std::max(1, static_cast<int>(std::ceil((exit - enter) / stepFraction)));
+    float clear = enter;
+    float hit = -1.0f;
+    for (int step = 0; step <= steps; ++step)
     {
-      continue;
+      const float t = enter + (exit - enter) * static_cast<float>(step) / static_cast<float>(steps);
+      if (t > earliest)
+      {
+        break;
+      }
+
+      if (shapesIntersect(collider, other.collider, displacement * t))
+      {
+        hit = t;
+        break;
+      }
+
+      clear = t;
     }
 
-    if (collidesWith(edge.collider, other.object, nullptr, nullptr))
+    if (hit < 0.0f)
     {
-      collidedObjects.emplace_back(other.object);
+      return;
     }
+
+    // Bisect the bracketing interval. Ends on the overlapping side, so the discrete pass sees a (shallow)
+    // contact at the new position and responds to it.
+    constexpr int refinements = 8;
+    for (int i = 0; i < refinements; ++i)
+    {
+      const float mid = 0.5f * (clear + hit);
+
+      if (shapesIntersect(collider, other.collider, displacement * mid))
+      {
+        hit = mid;
+      }
+      else
+      {
+        clear = mid;
+      }
+    }
+
+    earliest = std::min(earliest, hit);
+  };
+
+  const uint32_t layers = m_layerMatrix[collider->getLayer()];
+
+  queryDynamic({ sweptMin, sweptMax }, layers, [&](const uint32_t j) {
+    sweepAgainst(m_collisionEdges[j], { m_bounds.min(j), m_bounds.max(j) });
+  });
+
+  queryStatic({ sweptMin, sweptMax }, layers, [&](const uint32_t index) {
+    sweepAgainst(m_staticEdges[index], { m_staticBounds.min(index), m_staticBounds.max(index) });
+  });
+
+  return earliest;
+}
+
+void CollisionSystem::reset()
+{
+  // The edges and query snapshots are the previous scene's (or run's) until the next pass; drop them so
+  // timeOfImpact can't sweep into them, queries fall back to scanning the live scene, and the next pass
+  // re-partitions (a new scene can reuse the old one's address and version).
+  m_collisionEdges.clear();
+  m_staticEdges.clear();
+  m_bounds.clear();
+  m_staticBounds.clear();
+  for (auto& tree : m_staticTrees)
+  {
+    tree.clear();
+  }
+  m_layerBegin.fill(0);
+  m_staticLayerBegin.fill(0);
+  m_occupiedLayers = 0;
+  m_staticOccupiedLayers = 0;
+  m_staticShapes.clear();
+  m_staticShapeBegin.clear();
+  m_partitionObjectManager = nullptr;
+  m_partitionVersion = 0;
+  m_queryTree.clear();
+  m_queryShapes.clear();
+  m_queryObjectManager = nullptr;
+  m_edgeContacts.clear();
+  m_triggerPairs.clear();
+  m_tickPairs.clear();
+  m_previousPairs.clear();
+  m_enters.clear();
+  m_stays.clear();
+  m_exits.clear();
+}
+
+void CollisionSystem::findCollisions(const size_t index, std::vector<std::shared_ptr<Object>>& collidedObjects) const
+{
+  const auto& edge = m_collisionEdges[index];
+
+  // Trigger pairs belong to the trigger pass.
+  if (edge.collider->isTrigger())
+  {
+    return;
   }
+
+  forEachCandidate(index, [&](const CollisionEdge& other) {
+    if (!other.collider->isTrigger() && collidesWith(edge.collider, other.object, nullptr, nullptr))
+    {
+      collidedObjects.emplace_back(other.object);
+    }
+  });
 }
 
 void CollisionSystem::handleCollisions(const std::shared_ptr<RigidBody>& rigidBody, const std::shared_ptr<Collider>& collider,
@@ -155,12 +747,6 @@ void CollisionSystem::handleCollisions(const std::shared_ptr<RigidBody>& rigidBo
 {
   if (collidedObjects.size() == 1)
   {
-    // Triggers still recorded the pair (events fire), but get no MTV correction / impulse.
-    if (isTriggerPair(collider, collidedObjects[0]))
-    {
-      return;
-    }
-
     glm::vec3 mtv;
     glm::vec3 collisionPoint;
     if (collidesWith(collider, collidedObjects[0], &mtv, &collisionPoint))
@@ -198,11 +784,6 @@ void CollisionSystem::handleCollisions(const std::shared_ptr<RigidBody>& rigidBo
       {
         chosenFlags[j] = true;
 
-        if (isTriggerPair(collider, collidedObjects[j]))
-        {
-          continue;
-        }
-
         glm::vec3 mtv;
         glm::vec3 collisionPoint;
         if (collidesWith(collider, collidedObjects[j], &mtv, &collisionPoint))
@@ -214,15 +795,71 @@ void CollisionSystem::handleCollisions(const std::shared_ptr<RigidBody>& rigidBo
   }
 }
 
-bool CollisionSystem::isTriggerPair(const std::shared_ptr<Collider>& collider, const std::shared_ptr<Object>& other)
+bool CollisionSystem::triggerOverlaps(const std::shared_ptr<Collider>& a, const std::shared_ptr<Collider>& b)
 {
-  if (collider->isTrigger())
+  const auto shapesA = shapesOf(a);
+  const auto shapesB = shapesOf(b);
+
+  // The caller's box test was on the colliders' boxes, which are a compound's shapes' only in union.
+  const bool boundsOverlap = shapesA.size() == 1 && shapesA[0] == a && shapesB.size() == 1 && shapesB[0] == b;
+
+  for (const auto& shapeA : shapesA)
   {
-    return true;
+    for (const auto& shapeB : shapesB)
+    {
+      if (shapesOverlap(shapeA, shapeB, boundsOverlap))
+      {
+        return true;
+      }
+    }
   }
 
-  const auto otherCollider = other->getComponent<Collider>(ComponentType::collider);
-  return otherCollider && otherCollider->isTrigger();
+  return false;
+}
+
+bool CollisionSystem::shapesOverlap(const std::shared_ptr<Collider>& a, const std::shared_ptr<Collider>& b,
+                                    const bool boundsOverlap)
+{
+  const auto typeA = a->getColliderType();
+  const auto typeB = b->getColliderType();
+
+  if (typeA == ColliderType::sphereCollider && typeB == ColliderType::sphereCollider)
+  {
+    const float radii = static_cast<SphereCollider&>(*a).getRadius() + static_cast<SphereCollider&>(*b).getRadius();
+    const glm::vec3 offset = b->getPosition() - a->getPosition();
+
+    return glm::dot(offset, offset) <= radii * radii;
+  }
+
+  if (typeA == ColliderType::sphereCollider && typeB == ColliderType::boxCollider)
+  {
+    return sphereOverlapsBox(a->getPosition(), static_cast<SphereCollider&>(*a).getRadius(), static_cast<BoxCollider&>(*b));
+  }
+
+  if (typeA == ColliderType::boxCollider && typeB == ColliderType::sphereCollider)
+  {
+    return sphereOverlapsBox(b->getPosition(), static_cast<SphereCollider&>(*b).getRadius(), static_cast<BoxCollider&>(*a));
+  }
+
+  if (typeA == ColliderType::boxCollider && typeB == ColliderType::boxCollider &&
+      isAxisAligned(static_cast<BoxCollider&>(*a).getWorldMatrix()) &&
+      isAxisAligned(static_cast<BoxCollider&>(*b).getWorldMatrix()))
+  {
+    if (boundsOverlap)
+    {
+      return true;
+    }
+
+    const auto boxA = makeBoundingBox(a->getBoundsShape());
+    const auto boxB = makeBoundingBox(b->getBoundsShape());
+
+    return boxA.minX <= boxB.maxX && boxB.minX <= boxA.maxX &&
+           boxA.minY <= boxB.maxY && boxB.minY <= boxA.maxY &&
+           boxA.minZ <= boxB.maxZ && boxB.minZ <= boxA.maxZ;
+  }
+
+  Simplex simplex;
+  return intersects(a.get(), b, glm::vec3(0), simplex);
 }
 
 bool CollisionSystem::layersCollide(const std::shared_ptr<Collider>& a, const std::shared_ptr<Collider>& b)
@@ -243,36 +880,55 @@ bool CollisionSystem::collidesWith(const std::shared_ptr<Collider>& collider, co
     return false;
   }
 
-  if (collider->getColliderType() == ColliderType::sphereCollider && otherCollider->getColliderType() == ColliderType::sphereCollider)
-  {
-    return handleSphereToSphereCollision(collider, otherCollider, mtv, collisionPoint);
-  }
-
-  Simplex simplex;
-  glm::vec3 direction{1, 0, 0};
+  // One contact per object pair, as for single shapes: across a compound's shape pairs, the deepest one
+  // that touches is the contact reported and resolved.
+  bool touching = false;
+  float deepest = -1.0f;
 
-  auto support = getSupport(collider.get(), otherCollider, normalize(direction));
-  simplex.addVertex({support, direction});
+  for (const auto& shape : shapesOf(collider))
+  {
+    for (const auto& otherShape : shapesOf(otherCollider))
+    {
+      glm::vec3 shapeMtv(0.0f);
+      glm::vec3 shapePoint(0.0f);
+      if (!shapeCollidesWith(shape, otherShape, mtv ? &shapeMtv : nullptr, collisionPoint ? &shapePoint : nullptr))
+      {
+        continue;
+      }
 
-  direction *= -1.0f;
+      if (mtv == nullptr)
+      {
+        return true;
+      }
 
-  constexpr uint8_t maxIterations = 50;
-  uint8_t iteration = 0;
-  do
-  {
-    ++iteration;
+      touching = true;
 
-    support = getSupport(collider.get(), otherCollider, normalize(direction));
+      if (const float depth = dot(shapeMtv, shapeMtv); depth > deepest)
+      {
+        deepest = depth;
+        *mtv = shapeMtv;
 
-    if (glm::dot(support, direction) < 0)
-    {
-      return false;
+        if (collisionPoint != nullptr)
+        {
+          *collisionPoint = shapePoint;
+        }
+      }
     }
+  }
 
-    simplex.addVertex({support, direction});
-  } while (iteration < maxIterations && !expandSimplex(simplex, direction));
+  return touching;
+}
 
-  if (iteration == maxIterations)
+bool CollisionSystem::shapeCollidesWith(const std::shared_ptr<Collider>& collider, const std::shared_ptr<Collider>& otherCollider,
+                                        glm::vec3* mtv, glm::vec3* collisionPoint)
+{
+  if (collider->getColliderType() == ColliderType::sphereCollider && otherCollider->getColliderType() == ColliderType::sphereCollider)
+  {
+    return handleSphereToSphereCollision(collider, otherCollider, mtv, collisionPoint);
+  }
+
+  Simplex simplex;
+  if (!intersects(collider.get(), otherCollider, glm::vec3(0), simplex))
   {
     return false;
   }
@@ -303,6 +959,32 @@ bool CollisionSystem::collidesWith(const std::shared_ptr<Collider>& collider, co
   return true;
 }
 
+bool CollisionSystem::intersects(Collider* collider, const std::shared_ptr<Collider>& otherCollider,
+                                 const glm::vec3& offset, Simplex& simplex)
+{
+  return intersects([&](const glm::vec3& direction) {
+    return getSupport(collider, otherCollider, direction) + offset;
+  }, simplex);
+}
+
+bool CollisionSystem::shapesIntersect(const std::shared_ptr<Collider>& collider,
+                                      const std::shared_ptr<Collider>& otherCollider, const glm::vec3& offset)
+{
+  for (const auto& shape : shapesOf(collider))
+  {
+    for (const auto& otherShape : shapesOf(otherCollider))
+    {
+      Simplex simplex;
+      if (intersects(shape.get(), otherShape, offset, simplex))
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 bool CollisionSystem::handleSphereToSphereCollision(const std::shared_ptr<Collider>& collider,
                                                     const std::shared_ptr<Collider>& otherCollider,
                                                     glm::vec3* mtv, glm::vec3* collisionPoint)
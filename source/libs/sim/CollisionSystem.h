@@ -1,8 +1,16 @@
 #ifndef COLLISIONSYSTEM_H
 #define COLLISIONSYSTEM_H
 
+#include "collisions/AabbTree.h"
+#include "collisions/ColliderBounds.h"
+#include "collisions/Simplex.h"
+#include "queries/QueryShape.h"
+#include <scenes/PhysicsSettings.h>
 #include <glm/vec3.hpp>
+#include <array>
+#include <bit>
 #include <compare>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <uuid.h>
@@ -11,7 +19,6 @@ class ObjectManager;
 class Object;
 class Collider;
 class RigidBody;
-class Simplex;
 
 struct CollisionEdge {
   std::shared_ptr<Object> object;
@@ -39,21 +46,128 @@ struct CollisionPair {
 
 class CollisionSystem {
 public:
+  // One collision step: detect, respond, and add the step's contacts to the tick's pair set. With
+  // substepping this runs several times per script tick; commitEvents() then turns the tick's pairs into
+  // events once, so a contact that only lasts one substep still reaches scripts as an enter (and exit).
   void fixedUpdate(const ObjectManager& objectManager);
 
-  // Collision events for the most recent tick, diffed against the tick before it. enters = pairs new
+  // Close the script tick: diff the pairs gathered by this tick's steps against the previous tick's to
+  // refresh the event lists below, then start a fresh pair set.
+  void commitEvents();
+
+  // Deterministic mode, for lockstep/replay/rollback: the pass runs serially and colliders with equal
+  // sort keys keep scene order, so contacts are resolved (and bodies written) in the same order on every
+  // run. Off by default - the parallel pass resolves contacts in whatever order the threads get to them.
+  void setDeterministic(bool deterministic);
+  [[nodiscard]] bool isDeterministic() const { return m_deterministic; }
+
+  // The active scene's layer matrix (PhysicsSettings::layerMatrix; made symmetric here). Colliders are
+  // bucketed by layer, and a collider only ever visits the buckets its layer's row includes, so layers that
+  // never interact (debris vs debris) cost nothing - not even a rejected pair. Each collider's own mask is
+  // still checked per pair on top of it. Defaults to every layer pair.
+  void setLayerMatrix(const std::array<uint32_t, PhysicsSettings::layerCount>& layerMatrix);
+
+  // Collision events for the most recently committed tick, diffed against the tick before it. enters = pairs new
   // this tick, stays = pairs present both ticks, exits = pairs gone this tick. Sorted; consumed by the
   // app to dispatch onCollisionEnter/Stay/Exit into scripts.
   [[nodiscard]] const std::vector<CollisionPair>& getCollisionEnters() const { return m_enters; }
   [[nodiscard]] const std::vector<CollisionPair>& getCollisionStays() const { return m_stays; }
   [[nodiscard]] const std::vector<CollisionPair>& getCollisionExits() const { return m_exits; }
 
+  // Continuous collision: the earliest fraction [0, 1] of displacement at which collider (owned by object)
+  // first touches a solid collider, or 1 if the sweep is clear. Candidates are the dynamic colliders from
+  // the sweep-and-prune edges of the last pass plus the static colliders from the static tree, filtered by
+  // the swept bounding box, less the mover's own body's colliders; each is then stepped across the stretch
+  // of the path where the two boxes overlap, in increments no larger than the mover's smallest half-extent
+  // (so nothing thinner than that can be skipped, however long the move), and the first hit bisected down
+  // to the time of impact. Used by PhysicsSystem for bodies flagged continuousCollision.
+  [[nodiscard]] float timeOfImpact(const std::shared_ptr<Object>& object, const std::shared_ptr<Collider>& collider,
+                                   const glm::vec3& displacement) const;
+
+  // The broadphase SceneQueries run against: snapshots of every collider (shape + layer + uuid) in two AABB
+  // trees, the static one kept from the last partition and the dynamic one rebuilt at the end of each pass.
+  // getQueryObjectManager is the scene they were built from (null before the first pass or after reset), so
+  // queries against any other scene know to fall back to a scan.
+  [[nodiscard]] const ObjectManager* getQueryObjectManager() const { return m_queryObjectManager; }
+
+  // visit(shape) for every collider snapshot whose box overlaps box. Static layers outside layerMask aren't
+  // walked at all; dynamic snapshots are all offered (the caller still filters by layer).
+  template<typename Visitor>
+  void queryBroadphase(const Aabb& box, uint32_t layerMask, Visitor&& visit) const;
+
+  // visit(shape, maxDistance) for every collider snapshot whose box the ray (direction normalized) enters
+  // within maxDistance, with the same layerMask pruning. As with AabbTree::raycast the visitor may shrink
+  // maxDistance; the shrunk value carries over from tree to tree.
+  template<typename Visitor>
+  void raycastBroadphase(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, uint32_t layerMask,
+                         Visitor&& visit) const;
+
+  // GJK boolean test on any two convex shapes, given as the support function of their Minkowski
+  // difference: support(direction) -> furthest point of A along direction minus furthest point of B
+  // against it (direction arrives normalized). The collider pass and the scene queries' shape casts share
+  // it. Leaves the terminating simplex for EPA on a hit.
+  template<typename SupportFn>
+  static bool intersects(const SupportFn& support, Simplex& simplex);
+
   // Clear the recorded pair history + event lists. Call on a scene start/stop/switch so contacts from a
   // previous run don't leak into the next run's first diff as spurious enter/exit events.
   void reset();
 
 private:
+  // Colliders are split by whether they can move under physics. Dynamic ones (the object, or an ancestor,
+  // has a RigidBody) are re-sorted and swept against each other every pass. Static ones are only ever tested
+  // from the dynamic side, through a tree that is rebuilt when the split changes or one of them is moved by
+  // hand (a script sliding a door), so a level's worth of static-vs-static pairs is never looked at.
   std::vector<CollisionEdge> m_collisionEdges;
+  std::vector<CollisionEdge> m_staticEdges;
+
+  // Both edge lists are grouped by collider layer: layer L's edges are [begin[L], begin[L + 1]), and bit L
+  // of the occupied mask is set when that range isn't empty. The dynamic grouping is redone with the sort
+  // each pass, the static one on partition.
+  using LayerRanges = std::array<uint32_t, PhysicsSettings::layerCount + 1>;
+  LayerRanges m_layerBegin{};
+  LayerRanges m_staticLayerBegin{};
+  uint32_t m_occupiedLayers = 0;
+  uint32_t m_staticOccupiedLayers = 0;
+
+  std::array<uint32_t, PhysicsSettings::layerCount> m_layerMatrix = PhysicsSettings().layerMatrix;
+
+  // Every dynamic edge's world AABB, slot i = edge i, refreshed in one batch before the pass and again after
+  // response. The broadphase (pair sweep, continuous sweeps, query tree) reads boxes only from here.
+  ColliderBounds m_bounds;
+
+  // The same for the static edges. Refreshed every pass too, but that is only a cached-id compare per
+  // collider unless one of them moved.
+  ColliderBounds m_staticBounds;
+
+  // One tree per static layer, over that layer's range of the static edges (tree item i = static edge
+  // m_staticLayerBegin[L] + i).
+  std::array<AabbTree, PhysicsSettings::layerCount> m_staticTrees;
+
+  // Query snapshots of the static edges: edge i's are [m_staticShapeBegin[i], m_staticShapeBegin[i + 1])
+  // (several for a compound, none for a shape the queries don't handle).
+  std::vector<QueryShape> m_staticShapes;
+  std::vector<uint32_t> m_staticShapeBegin;
+
+  // The scene and structure version the split was taken from; either changing re-partitions.
+  const ObjectManager* m_partitionObjectManager = nullptr;
+  uint64_t m_partitionVersion = 0;
+
+  bool m_deterministic = false;
+
+  const ObjectManager* m_queryObjectManager = nullptr;
+  AabbTree m_queryTree;
+  std::vector<QueryShape> m_queryShapes;
+
+  // This pass's contacts: the solid objects each dynamic edge touched (slot i = edge i, so the parallel
+  // pair loop records lock-free) and the trigger overlaps, found by their own pass. Merged into the pair set
+  // by recordCollisionEvents.
+  std::vector<std::vector<std::shared_ptr<Object>>> m_edgeContacts;
+  std::vector<CollisionPair> m_triggerPairs;
+
+  // Every pair seen by the steps of the current script tick, unsorted and with duplicates until
+  // commitEvents() canonicalizes it.
+  std::vector<CollisionPair> m_tickPairs;
 
   // Sorted set of colliding pairs from the previous tick, diffed against the current tick to produce
   // the enter/stay/exit lists.
@@ -62,27 +176,81 @@ private:
   std::vector<CollisionPair> m_stays;
   std::vector<CollisionPair> m_exits;
 
+  // Re-derive the static/dynamic split from the scene and rebuild the static tree.
+  void partition(const ObjectManager& objectManager);
+
+  // Whether a static collider's layer was edited since the partition (setLayer, or an editor edit that
+  // reloads the component), leaving it in the wrong layer's tree. Layer isn't structure, so the version
+  // doesn't catch it.
+  [[nodiscard]] bool staticLayersChanged() const;
+
+  // Rebuild the static trees and query snapshots from m_staticBounds.
+  void buildStaticTree();
+
+  // visit(edge index) for every static edge of a layer in layers whose box overlaps box.
+  template<typename Visitor>
+  void queryStatic(const Aabb& box, uint32_t layers, Visitor&& visit) const;
+
+  // visit(edge index) for every dynamic edge of a layer in layers whose box overlaps box: a sweep and prune
+  // along x within each layer's range.
+  template<typename Visitor>
+  void queryDynamic(const Aabb& box, uint32_t layers, Visitor&& visit) const;
+
+  // visit(other edge) for every collider edge i can touch this pass: box overlap, on an interacting layer
+  // and mask, and not its own object, parent or child.
+  template<typename Visitor>
+  void forEachCandidate(size_t index, Visitor&& visit) const;
+
+  // The physical pass: contacts between solid colliders, resolved through PhysicsSystem.
   void checkCollisions();
 
-  // Build this tick's sorted pair set from the per-edge collision results and diff it against the
-  // previous tick to refresh m_enters/m_stays/m_exits.
-  void recordCollisionEvents(const std::vector<std::vector<std::shared_ptr<Object>>>& perEdgeCollisions);
+  // The trigger pass: every pair with a trigger on either side, tested for overlap alone (no response, so
+  // no MTV or contact point) with analytic tests where the shapes allow. Walks out from the triggers only,
+  // so a scene without any costs one flag read per collider.
+  void checkTriggers();
+
+  // Snapshot the pass's dynamic colliders (after collision response, so at their final positions for the
+  // tick) and rebuild the dynamic query tree over them.
+  void buildQueryTree(const ObjectManager& objectManager);
 
-  void findCollisions(const CollisionEdge& edge, std::vector<std::shared_ptr<Object>>& collidedObjects) const;
+  // Add this step's per-edge collision results and trigger overlaps to the tick's pair set.
+  void recordCollisionEvents();
+
+  void findCollisions(size_t index, std::vector<std::shared_ptr<Object>>& collidedObjects) const;
 
   static void handleCollisions(const std::shared_ptr<RigidBody>& rigidBody, const std::shared_ptr<Collider>& collider,
                                const std::vector<std::shared_ptr<Object>>& collidedObjects);
 
-  // A contact is a trigger (events fire, but no physical response) if either collider is flagged as one.
-  static bool isTriggerPair(const std::shared_ptr<Collider>& collider, const std::shared_ptr<Object>& other);
+  // Boolean overlap for the trigger pass, given that the pair's bounding boxes already overlap: whether any
+  // shape of a overlaps any shape of b (a compound is its shapes; anything else is one).
+  static bool triggerOverlaps(const std::shared_ptr<Collider>& a, const std::shared_ptr<Collider>& b);
+
+  // One shape pair of triggerOverlaps: sphere/sphere and sphere/box analytically, two axis-aligned boxes
+  // by their bounding boxes (which are the boxes; already known to overlap when boundsOverlap), anything
+  // else through GJK without EPA.
+  static bool shapesOverlap(const std::shared_ptr<Collider>& a, const std::shared_ptr<Collider>& b, bool boundsOverlap);
 
-  // Broad-phase layer filter: true only if each collider's mask includes the other's layer.
+  // Per-pair mask filter: true only if each collider's mask includes the other's layer. (The layer matrix
+  // has already decided which layers are visited at all.)
   static bool layersCollide(const std::shared_ptr<Collider>& a, const std::shared_ptr<Collider>& b);
 
-  // GJK/EPA narrow phase.
+  // GJK/EPA narrow phase between collider and other's collider, over their shape pairs.
   static bool collidesWith(const std::shared_ptr<Collider>& collider, const std::shared_ptr<Object>& other,
                            glm::vec3* mtv, glm::vec3* collisionPoint);
 
+  // The narrow phase for one box/sphere pair.
+  static bool shapeCollidesWith(const std::shared_ptr<Collider>& collider, const std::shared_ptr<Collider>& otherCollider,
+                                glm::vec3* mtv, glm::vec3* collisionPoint);
+
+  // GJK boolean test with collider translated by offset (the support point of a translated shape is just
+  // the original support plus the offset). Leaves the terminating simplex for EPA on a hit.
+  static bool intersects(Collider* collider, const std::shared_ptr<Collider>& otherCollider,
+                         const glm::vec3& offset, Simplex& simplex);
+
+  // intersects over every shape pair, for callers that only need the boolean.
+  static bool shapesIntersect(const std::shared_ptr<Collider>& collider, const std::shared_ptr<Collider>& otherCollider,
+                              const glm::vec3& offset);
+
   static bool handleSphereToSphereCollision(const std::shared_ptr<Collider>& collider,
                                             const std::shared_ptr<Collider>& otherCollider,
                                             glm::vec3* mtv, glm::vec3* collisionPoint);
@@ -93,6 +261,87 @@ private:
   static bool tetrahedronCase(Simplex& simplex, glm::vec3& direction);
 };
 
+template<typename Visitor>
+void CollisionSystem::queryBroadphase(const Aabb& box, const uint32_t layerMask, Visitor&& visit) const
+{
+  queryStatic(box, layerMask, [&](const uint32_t index) {
+    for (uint32_t shape = m_staticShapeBegin[index]; shape < m_staticShapeBegin[index + 1]; ++shape)
+    {
+      visit(m_staticShapes[shape]);
+    }
+  });
+
+  m_queryTree.query(box, [&](const uint32_t item) {
+    visit(m_queryShapes[item]);
+  });
+}
+
+template<typename Visitor>
+void CollisionSystem::raycastBroadphase(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                                        const uint32_t layerMask, Visitor&& visit) const
+{
+  for (uint32_t layers = layerMask & m_staticOccupiedLayers; layers != 0u; layers &= layers - 1u)
+  {
+    const uint32_t layer = static_cast<uint32_t>(std::countr_zero(layers));
+    const uint32_t begin = m_staticLayerBegin[layer];
+
+    m_staticTrees[layer].raycast(origin, direction, maxDistance, [&](const uint32_t item, float& nearest) {
+      for (uint32_t shape = m_staticShapeBegin[begin + item]; shape < m_staticShapeBegin[begin + item + 1]; ++shape)
+      {
+        visit(m_staticShapes[shape], nearest);
+        maxDistance = nearest;
+      }
+    });
+  }
+
+  m_queryTree.raycast(origin, direction, maxDistance, [&](const uint32_t item, float& nearest) {
+    visit(m_queryShapes[item], nearest);
+  });
+}
+
+template<typename Visitor>
+void CollisionSystem::queryStatic(const Aabb& box, const uint32_t layers, Visitor&& visit) const
+{
+  for (uint32_t remaining = layers & m_staticOccupiedLayers; remaining != 0u; remaining &= remaining - 1u)
+  {
+    const uint32_t layer = static_cast<uint32_t>(std::countr_zero(remaining));
+    const uint32_t begin = m_staticLayerBegin[layer];
+
+    m_staticTrees[layer].query(box, [&](const uint32_t item) {
+      visit(begin + item);
+    });
+  }
+}
+
+template<typename SupportFn>
+bool CollisionSystem::intersects(const SupportFn& support, Simplex& simplex)
+{
+  glm::vec3 direction{1, 0, 0};
+
+  auto point = support(normalize(direction));
+  simplex.addVertex({point, direction});
+
+  direction *= -1.0f;
+
+  constexpr uint8_t maxIterations = 50;
+  uint8_t iteration = 0;
+  do
+  {
+    ++iteration;
+
+    point = support(normalize(direction));
+
+    if (glm::dot(point, direction) < 0)
+    {
+      return false;
+    }
+
+    simplex.addVertex({point, direction});
+  } while (iteration < maxIterations && !expandSimplex(simplex, direction));
+
+  return iteration != maxIterations;
+}
+
 
 
 #endif //COLLISIONSYSTEM_H
@@ -1,18 +1,70 @@
 #include "PhysicsSystem.h"
+#include "CollisionSystem.h"
+#include <JobSystem.h>
 #include <objects/Object.h>
 #include <objects/ObjectManager.h>
 #include <objects/components/Component.h>
 #include <objects/components/RigidBody.h>
 #include <objects/components/Transform.h>
+#include <objects/components/collisions/BoxCollider.h>
+#include <objects/components/collisions/Collider.h>
+#include <objects/components/collisions/CompoundCollider.h>
+#include <objects/components/collisions/ConvexHull.h>
+#include <objects/components/collisions/ConvexHullCollider.h>
+#include <objects/components/collisions/SphereCollider.h>
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+  // The earliest time of impact over every collider that moves with body: object's own, then its
+  // children's, down to any child that carries a body of its own (which integrates, and sweeps, itself).
+  float sweepBody(const CollisionSystem& collisionSystem, const RigidBody& body, const std::shared_ptr<Object>& object,
+                  const glm::vec3& displacement)
+  {
+    if (object->getComponent<RigidBody>(ComponentType::rigidBody).get() != &body)
+    {
+      return 1.0f;
+    }
 
-void PhysicsSystem::fixedUpdate(const ObjectManager& objectManager, const float dt)
+    float earliest = 1.0f;
+    if (const auto collider = object->getComponent<Collider>(ComponentType::collider))
+    {
+      earliest = collisionSystem.timeOfImpact(object, collider, displacement);
+    }
+
+    for (const auto& child : object->getChildren())
+    {
+      earliest = std::min(earliest, sweepBody(collisionSystem, body, child, displacement));
+    }
+
+    return earliest;
+  }
+}
+
+void PhysicsSystem::fixedUpdate(const ObjectManager& objectManager, const float dt, const CollisionSystem* collisionSystem,
+                                const float tickFraction)
 {
+  struct BodyStep {
+    std::shared_ptr<Object> object;
+    std::shared_ptr<RigidBody> rigidBody;
+    std::shared_ptr<Transform> transform;
+  };
+
+  // A body on a root object that doesn't sweep reads and writes only its own body + transform, so those
+  // integrate in parallel, and the result doesn't depend on thread order. A child's world transform reads
+  // its parent's (which may be integrating on another thread), and a continuous sweep reads other
+  // colliders' live shapes, so those bodies run afterwards, serially, in scene order.
+  std::vector<BodyStep> independent;
+  std::vector<BodyStep> ordered;
+
   for (const auto& object : objectManager.getAllObjects())
   {
-    const auto rigidBody = object->getComponent<RigidBody>(ComponentType::rigidBody);
-    const auto transform = object->getComponent<Transform>(ComponentType::transform);
+    auto rigidBody = object->getComponent<RigidBody>(ComponentType::rigidBody);
+    auto transform = object->getComponent<Transform>(ComponentType::transform);
 
     // getComponent walks to the parent for rigidBody, so guard on ownership to integrate each body exactly once.
     if (!rigidBody || !transform || rigidBody->getOwner() != object.get())
@@ -20,19 +72,39 @@ void PhysicsSystem::fixedUpdate(const ObjectManager& objectManager, const float
       continue;
     }
 
+    const bool sweeps = collisionSystem && rigidBody->getContinuousCollision();
+    auto& steps = object->getParent() || sweeps ? ordered : independent;
+    steps.push_back({ object, std::move(rigidBody), std::move(transform) });
+  }
+
+  const auto step = [&](const BodyStep& body) {
     // Apply any forces a script queued this tick (e.g. PlayerScript's input-driven movement), then
     // clear them, before integrating.
-    for (const auto& pending : rigidBody->getPendingForces())
+    for (const auto& pending : body.rigidBody->getPendingForces())
     {
-      applyForce(*rigidBody, *transform, pending.force, pending.position);
+      applyForce(*body.rigidBody, *body.transform, pending.force, pending.position);
     }
-    rigidBody->clearPendingForces();
+    body.rigidBody->clearPendingForces();
 
-    integrate(*rigidBody, *transform, dt);
+    integrate(*body.rigidBody, *body.transform, dt, tickFraction, collisionSystem, body.object);
+  };
+
+  constexpr size_t bodiesPerChunk = 64;
+  JobSystem::parallelFor("physics.integrate", independent.size(), bodiesPerChunk, [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      step(independent[i]);
+    }
+  });
+
+  for (const auto& body : ordered)
+  {
+    step(body);
   }
 }
 
-void PhysicsSystem::integrate(RigidBody& body, Transform& transform, const float dt)
+void PhysicsSystem::integrate(RigidBody& body, Transform& transform, const float dt, const float tickFraction,
+                              const CollisionSystem* collisionSystem, const std::shared_ptr<Object>& object)
 {
   body.setFalling(body.getNextFalling());
   body.setNextFalling(true);
@@ -43,16 +115,26 @@ void PhysicsSystem::integrate(RigidBody& body, Transform& transform, const float
     applyForce(body, transform, gravity, transform.getPosition());
   }
 
-  limitMovement(body, transform);
+  limitMovement(body, transform, tickFraction);
 
-  transform.move(body.getVelocity());
+  auto displacement = body.getVelocity() * tickFraction;
+
+  // Swept bodies stop at the first time of impact along the move, of any of their colliders; the collision
+  // pass that follows then sees the contact and applies the usual response. Velocity is untouched, so the
+  // impulse kills it.
+  if (collisionSystem && body.getContinuousCollision())
+  {
+    displacement *= sweepBody(*collisionSystem, body, object, displacement);
+  }
+
+  transform.move(displacement);
 
   const auto rotation = transform.getRotation();
   const auto newRotation = rotation + body.getAngularVelocity() * dt;
   transform.setRotation(newRotation);
 
   constexpr float damping = 0.99f;
-  body.setAngularVelocity(body.getAngularVelocity() * damping);
+  body.setAngularVelocity(body.getAngularVelocity() * std::pow(damping, tickFraction));
 }
 
 void PhysicsSystem::applyForce(RigidBody& body, const Transform& transform, const glm::vec3& force, const glm::vec3& position)
@@ -74,7 +156,7 @@ void PhysicsSystem::applyForce(RigidBody& body, const Transform& transform, cons
 
   const auto angularImpulse = glm::cross(r, force);
 
-  body.setAngularVelocity(body.getAngularVelocity() + angularImpulse * glm::inverse(getInertiaTensor(body, transform)));
+  body.setAngularVelocity(body.getAngularVelocity() + angularImpulse * getInverseInertia(body, transform));
 }
 
 void PhysicsSystem::handleCollision(RigidBody& body, const std::shared_ptr<Object>& other,
@@ -135,36 +217,91 @@ void PhysicsSystem::respondToCollision(RigidBody& body, Transform& transform, co
   transform.move(minimumTranslationVector);
 }
 
-void PhysicsSystem::limitMovement(RigidBody& body, const Transform& transform)
+void PhysicsSystem::limitMovement(RigidBody& body, const Transform& transform, const float tickFraction)
 {
   if (glm::length(body.getVelocity()) < 1e-5f)
   {
     return;
   }
 
+  // Friction keeps (1 - friction) of the horizontal velocity per tick; a substep keeps that to the power of
+  // its fraction, so the substeps of a tick compound to the same loss.
+  const float kept = std::pow(std::max(0.0f, 1.0f - body.getFriction()), tickFraction);
+
   const glm::vec2 horizontalVelocity(body.getVelocity().x, body.getVelocity().z);
-  const glm::vec2 frictionForce = -horizontalVelocity * body.getFriction();
+  const glm::vec2 frictionForce = -horizontalVelocity * (1.0f - kept);
 
   applyForce(body, transform, { frictionForce.x, 0.0f, frictionForce.y }, transform.getPosition());
 }
 
-glm::mat3x3 PhysicsSystem::getInertiaTensor(const RigidBody& body, const Transform& transform)
+const glm::mat3x3& PhysicsSystem::getInverseInertia(RigidBody& body, const Transform& transform)
 {
   const auto scale = transform.getScale();
 
-  const auto widthSquared = scale.x * scale.x;
-  const auto heightSquared = scale.y * scale.y;
-  const auto depthSquared = scale.z * scale.z;
+  if (!body.hasInverseInertia(scale))
+  {
+    // Diagonal, so inverting it is a per-axis reciprocal. An axis with no extent has no finite inverse;
+    // leave it 0 (no spin about it) rather than infinite.
+    const auto unitInertia = getUnitInertia(body, transform);
+    const float inverseMass = body.getInverseMass();
+
+    glm::mat3x3 inverseInertia(0.0f);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      inverseInertia[axis][axis] = unitInertia[axis] > 0.0f ? inverseMass / unitInertia[axis] : 0.0f;
+    }
+
+    body.setInverseInertia(scale, inverseInertia);
+  }
+
+  return body.getInverseInertia();
+}
+
+glm::vec3 PhysicsSystem::getUnitInertia(const RigidBody& body, const Transform& transform)
+{
+  // The 0.1 damps every tensor alike; it predates the shape split and tunes how readily bodies spin.
+  constexpr float tuning = 0.1f;
+
+  const auto collider = body.getOwner()->getComponent<Collider>(ComponentType::collider);
+
+  if (const auto sphere = std::dynamic_pointer_cast<SphereCollider>(collider))
+  {
+    const float radius = sphere->getRadius();
+
+    return glm::vec3(2.0f / 5.0f * radius * radius * tuning);
+  }
+
+  // Half-extents throughout: a box's scale is one, the unit cube spanning -1..1.
+  auto size = transform.getScale();
+  if (const auto box = std::dynamic_pointer_cast<BoxCollider>(collider))
+  {
+    size *= box->getLocalScale();
+  }
+  else if (const auto compound = std::dynamic_pointer_cast<CompoundCollider>(collider))
+  {
+    // Approximated as the box around all the shapes, in the same half-extent units as a box's scale.
+    glm::vec3 min;
+    glm::vec3 max;
+    compound->getLocalBounds(min, max);
+
+    size *= 0.5f * (max - min);
+  }
+  else if (const auto hull = std::dynamic_pointer_cast<ConvexHullCollider>(collider))
+  {
+    // Likewise the hull's bounding box.
+    size *= 0.5f * (hull->getHull()->getMax() - hull->getHull()->getMin());
+  }
 
-  const float factor = 1.0f / 12.0f * body.getMass() * 0.1f;
+  const auto widthSquared = size.x * size.x;
+  const auto heightSquared = size.y * size.y;
+  const auto depthSquared = size.z * size.z;
 
-  const float Ixx = factor * (heightSquared + depthSquared);
-  const float Iyy = factor * (widthSquared + depthSquared);
-  const float Izz = factor * (widthSquared + heightSquared);
+  // A solid box's 1/12 (w^2 + h^2) over full extents is 1/3 (x^2 + y^2) over half-extents.
+  const float factor = 1.0f / 3.0f * tuning;
 
   return {
-    Ixx, 0.0f, 0.0f,
-    0.0f, Iyy, 0.0f,
-    0.0f, 0.0f, Izz
+    factor * (heightSquared + depthSquared),
+    factor * (widthSquared + depthSquared),
+    factor * (widthSquared + heightSquared)
   };
 }
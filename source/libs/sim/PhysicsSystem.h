@@ -9,10 +9,19 @@ class ObjectManager;
 class Object;
 class Transform;
 class RigidBody;
+class CollisionSystem;
 
 class PhysicsSystem {
 public:
-  static void fixedUpdate(const ObjectManager& objectManager, float dt);
+  // collisionSystem is optional: when given, bodies flagged continuousCollision sweep their move against its
+  // broadphase and stop at the time of impact instead of tunnelling through thin geometry.
+  //
+  // tickFraction is the share of a script tick this step covers (1 / substeps; dt is already the step's own).
+  // A body's velocity is its displacement per tick and friction/damping are per-tick factors, so a substep
+  // moves by that fraction of the velocity and applies the matching root of each factor: N substeps of a
+  // body left alone end where one full step would.
+  static void fixedUpdate(const ObjectManager& objectManager, float dt, const CollisionSystem* collisionSystem = nullptr,
+                          float tickFraction = 1.0f);
 
   // Public so CollisionSystem can forward collisions here and script bindings can apply forces.
   static void applyForce(RigidBody& body, const Transform& transform, const glm::vec3& force, const glm::vec3& position);
@@ -21,13 +30,19 @@ public:
                               glm::vec3 minimumTranslationVector, glm::vec3 collisionPoint);
 
 private:
-  static void integrate(RigidBody& body, Transform& transform, float dt);
+  static void integrate(RigidBody& body, Transform& transform, float dt, float tickFraction,
+                        const CollisionSystem* collisionSystem, const std::shared_ptr<Object>& object);
 
   static void respondToCollision(RigidBody& body, Transform& transform, glm::vec3 minimumTranslationVector);
 
-  static void limitMovement(RigidBody& body, const Transform& transform);
+  static void limitMovement(RigidBody& body, const Transform& transform, float tickFraction);
 
-  [[nodiscard]] static glm::mat3x3 getInertiaTensor(const RigidBody& body, const Transform& transform);
+  // The body's inverse inertia tensor, from its cache unless the mass, scale or collider changed since.
+  [[nodiscard]] static const glm::mat3x3& getInverseInertia(RigidBody& body, const Transform& transform);
+
+  // Diagonal of the inertia tensor per unit mass, for the shape of the body's own collider: a solid sphere
+  // of its world radius, or a box of its world size (also the fallback with no collider, from the scale).
+  [[nodiscard]] static glm::vec3 getUnitInertia(const RigidBody& body, const Transform& transform);
 };
 
 
@@ -0,0 +1,78 @@
+#include "SimulationHash.h"
+#include <objects/Object.h>
+#include <objects/ObjectManager.h>
+#include <objects/components/Component.h>
+#include <objects/components/RigidBody.h>
+#include <objects/components/Transform.h>
+#include <glm/vec3.hpp>
+#include <bit>
+
+namespace {
+  constexpr uint64_t fnvOffsetBasis = 14695981039346656037ull;
+  constexpr uint64_t fnvPrime = 1099511628211ull;
+
+  void hashByte(uint64_t& hash, const uint8_t byte)
+  {
+    hash ^= byte;
+    hash *= fnvPrime;
+  }
+
+  void hashFloat(uint64_t& hash, const float value)
+  {
+    // The bit pattern, not the value: -0.0 vs 0.0 or a last-ulp difference is exactly what this is for.
+    const auto bits = std::bit_cast<uint32_t>(value);
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+      hashByte(hash, static_cast<uint8_t>(bits >> shift));
+    }
+  }
+
+  void hashVec3(uint64_t& hash, const glm::vec3& value)
+  {
+    hashFloat(hash, value.x);
+    hashFloat(hash, value.y);
+    hashFloat(hash, value.z);
+  }
+
+  void hashUUIDBytes(uint64_t& hash, const uuids::uuid& uuid)
+  {
+    for (const auto byte : uuid.as_bytes())
+    {
+      hashByte(hash, static_cast<uint8_t>(byte));
+    }
+  }
+}
+
+uint64_t hashSimulationState(const ObjectManager& objectManager)
+{
+  uint64_t hash = fnvOffsetBasis;
+
+  for (const auto& object : objectManager.getAllObjects())
+  {
+    hashUUIDBytes(hash, object->getUUID());
+
+    if (const auto transform = object->getComponent<Transform>(ComponentType::transform))
+    {
+      hashVec3(hash, transform->getLocalPosition());
+      hashVec3(hash, transform->getLocalRotation());
+      hashVec3(hash, transform->getLocalScale());
+    }
+
+    // Only the object's own body: getComponent falls back to the parent's for rigidBody.
+    const auto rigidBody = object->getComponent<RigidBody>(ComponentType::rigidBody);
+    if (rigidBody && rigidBody->getOwner() == object.get())
+    {
+      hashVec3(hash, rigidBody->getVelocity());
+      hashVec3(hash, rigidBody->getAngularVelocity());
+    }
+  }
+
+  return hash;
+}
+
+uint64_t hashUUID(const uuids::uuid& uuid)
+{
+  uint64_t hash = fnvOffsetBasis;
+  hashUUIDBytes(hash, uuid);
+  return hash;
+}
@@ -0,0 +1,21 @@
+#ifndef SIMULATIONHASH_H
+#define SIMULATIONHASH_H
+
+#include <cstdint>
+#include <uuid.h>
+
+class ObjectManager;
+
+// Fingerprint of the simulated state: FNV-1a over every object's uuid, local transform and rigid-body
+// velocities, in scene order, hashing the floats' exact bit patterns. Two runs in deterministic mode that
+// were fed the same project and inputs produce the same value tick for tick; the first tick they differ
+// is the first tick the simulations diverged.
+[[nodiscard]] uint64_t hashSimulationState(const ObjectManager& objectManager);
+
+// FNV-1a over the uuid's bytes. Unlike std::hash, the same on every platform and standard library, so it
+// can derive a seed that a Linux and a Windows server agree on.
+[[nodiscard]] uint64_t hashUUID(const uuids::uuid& uuid);
+
+
+
+#endif //SIMULATIONHASH_H
@@ -0,0 +1,102 @@
+#include "AabbTree.h"
+#include <algorithm>
+#include <numeric>
+
+void AabbTree::build(const std::vector<Aabb>& boxes)
+{
+  clear();
+
+  if (boxes.empty())
+  {
+    return;
+  }
+
+  m_items.resize(boxes.size());
+  std::iota(m_items.begin(), m_items.end(), 0u);
+
+  std::vector<glm::vec3> centers(boxes.size());
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    centers[i] = 0.5f * (boxes[i].min + boxes[i].max);
+  }
+
+  // A binary tree with leaves of up to leafSize items never needs more than 2n nodes.
+  m_nodes.reserve(2 * boxes.size());
+  m_nodes.emplace_back();
+
+  buildNode(0, 0, static_cast<uint32_t>(boxes.size()), boxes, centers);
+}
+
+void AabbTree::clear()
+{
+  m_nodes.clear();
+  m_items.clear();
+}
+
+void AabbTree::buildNode(const uint32_t nodeIndex, const uint32_t begin, const uint32_t end,
+                         const std::vector<Aabb>& boxes, const std::vector<glm::vec3>& centers)
+{
+  Aabb bounds;
+  Aabb centerBounds;
+  for (uint32_t i = begin; i < end; ++i)
+  {
+    bounds.expand(boxes[m_items[i]]);
+    centerBounds.expand({ centers[m_items[i]], centers[m_items[i]] });
+  }
+
+  m_nodes[nodeIndex].bounds = bounds;
+
+  const uint32_t count = end - begin;
+  const glm::vec3 spread = centerBounds.max - centerBounds.min;
+
+  // Small enough, or every center coincides (no split would separate anything): make a leaf.
+  if (count <= leafSize || (spread.x <= 0.0f && spread.y <= 0.0f && spread.z <= 0.0f))
+  {
+    m_nodes[nodeIndex].first = begin;
+    m_nodes[nodeIndex].count = count;
+    return;
+  }
+
+  int axis = 0;
+  if (spread.y > spread[axis])
+  {
+    axis = 1;
+  }
+  if (spread.z > spread[axis])
+  {
+    axis = 2;
+  }
+
+  // Median split: balanced by construction, so traversal depth stays logarithmic regardless of how the
+  // boxes are distributed.
+  const uint32_t middle = begin + count / 2;
+  std::nth_element(m_items.begin() + begin, m_items.begin() + middle, m_items.begin() + end,
+    [&centers, axis](const uint32_t a, const uint32_t b) {
+      return centers[a][axis] < centers[b][axis];
+    });
+
+  const auto left = static_cast<uint32_t>(m_nodes.size());
+  m_nodes.emplace_back();
+  m_nodes.emplace_back();
+
+  m_nodes[nodeIndex].first = left;
+  m_nodes[nodeIndex].count = 0;
+
+  buildNode(left, begin, middle, boxes, centers);
+  buildNode(left + 1, middle, end, boxes, centers);
+}
+
+float AabbTree::rayEntry(const Aabb& box, const glm::vec3& origin, const glm::vec3& inverseDirection,
+                         const float maxDistance)
+{
+  const glm::vec3 t1 = (box.min - origin) * inverseDirection;
+  const glm::vec3 t2 = (box.max - origin) * inverseDirection;
+
+  const glm::vec3 nearT = glm::min(t1, t2);
+  const glm::vec3 farT = glm::max(t1, t2);
+
+  const float entry = std::max({ nearT.x, nearT.y, nearT.z, 0.0f });
+  const float exit = std::min({ farT.x, farT.y, farT.z, maxDistance });
+
+  return entry <= exit ? entry : -1.0f;
+}
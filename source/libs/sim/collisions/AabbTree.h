@@ -0,0 +1,184 @@
+#ifndef AABBTREE_H
+#define AABBTREE_H
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+struct Aabb {
+  glm::vec3 min{ std::numeric_limits<float>::max() };
+  glm::vec3 max{ std::numeric_limits<float>::lowest() };
+
+  [[nodiscard]] bool overlaps(const Aabb& other) const
+  {
+    return min.x <= other.max.x && max.x >= other.min.x &&
+           min.y <= other.max.y && max.y >= other.min.y &&
+           min.z <= other.max.z && max.z >= other.min.z;
+  }
+
+  void expand(const Aabb& other)
+  {
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+  }
+};
+
+// A bounding volume hierarchy over a fixed set of boxes, built top-down in one go (median split on the
+// widest axis). It isn't refitted incrementally: whoever owns it rebuilds it when its boxes change, which
+// for the collision system is once per pass. Items are reported by their index in the array given to build,
+// so the caller keeps whatever per-item data it needs in a parallel array.
+class AabbTree {
+public:
+  void build(const std::vector<Aabb>& boxes);
+
+  void clear();
+
+  [[nodiscard]] bool empty() const { return m_nodes.empty(); }
+
+  // visit(item) for every item whose box overlaps box.
+  template<typename Visitor>
+  void query(const Aabb& box, Visitor&& visit) const;
+
+  // visit(item, maxDistance) for every item whose box the ray (direction normalized) enters within
+  // maxDistance, nearer subtrees first. The visitor may shrink maxDistance (e.g. to its nearest hit so far),
+  // which prunes every subtree that starts beyond it.
+  template<typename Visitor>
+  void raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Visitor&& visit) const;
+
+private:
+  // Internal nodes have count 0 and their children at first and first + 1; leaves hold count items
+  // starting at m_items[first].
+  struct Node {
+    Aabb bounds;
+    uint32_t first = 0;
+    uint32_t count = 0;
+  };
+
+  static constexpr uint32_t leafSize = 4;
+
+  // Deep enough for any tree a median split can produce over a 32-bit item count.
+  static constexpr size_t maxDepth = 64;
+
+  std::vector<Node> m_nodes;
+  std::vector<uint32_t> m_items;
+
+  void buildNode(uint32_t nodeIndex, uint32_t begin, uint32_t end, const std::vector<Aabb>& boxes,
+                 const std::vector<glm::vec3>& centers);
+
+  // Entry distance of the ray into box (inverseDirection = 1 / direction per axis), or a negative value if
+  // it misses or enters beyond maxDistance.
+  static float rayEntry(const Aabb& box, const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance);
+};
+
+
+template<typename Visitor>
+void AabbTree::query(const Aabb& box, Visitor&& visit) const
+{
+  if (m_nodes.empty())
+  {
+    return;
+  }
+
+  std::array<uint32_t, maxDepth> stack{};
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0)
+  {
+    const Node& node = m_nodes[stack[--stackSize]];
+
+    if (!node.bounds.overlaps(box))
+    {
+      continue;
+    }
+
+    if (node.count > 0)
+    {
+      for (uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        visit(m_items[i]);
+      }
+      continue;
+    }
+
+    stack[stackSize++] = node.first;
+    stack[stackSize++] = node.first + 1;
+  }
+}
+
+template<typename Visitor>
+void AabbTree::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Visitor&& visit) const
+{
+  if (m_nodes.empty())
+  {
+    return;
+  }
+
+  // A zero component would make 1/d infinite and (bound - origin) * inf NaN on a face the ray lies in;
+  // a huge finite value keeps the slab test well-defined.
+  glm::vec3 inverseDirection;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    constexpr float huge = 1e30f;
+    inverseDirection[axis] = std::abs(direction[axis]) > 1e-12f
+      ? 1.0f / direction[axis]
+      : (direction[axis] < 0.0f ? -huge : huge);
+  }
+
+  if (rayEntry(m_nodes[0].bounds, origin, inverseDirection, maxDistance) < 0.0f)
+  {
+    return;
+  }
+
+  // Each entry carries the distance at which the ray entered the node, so a node pushed before the
+  // visitor shrank maxDistance can still be skipped when it's popped.
+  std::array<std::pair<uint32_t, float>, maxDepth> stack{};
+  size_t stackSize = 0;
+  stack[stackSize++] = { 0, 0.0f };
+
+  while (stackSize > 0)
+  {
+    const auto [nodeIndex, entry] = stack[--stackSize];
+    if (entry > maxDistance)
+    {
+      continue;
+    }
+
+    const Node& node = m_nodes[nodeIndex];
+
+    if (node.count > 0)
+    {
+      for (uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        visit(m_items[i], maxDistance);
+      }
+      continue;
+    }
+
+    const float leftEntry = rayEntry(m_nodes[node.first].bounds, origin, inverseDirection, maxDistance);
+    const float rightEntry = rayEntry(m_nodes[node.first + 1].bounds, origin, inverseDirection, maxDistance);
+
+    // Push the farther child first so the nearer one is visited (and can tighten maxDistance) first.
+    if (leftEntry >= 0.0f && rightEntry >= 0.0f)
+    {
+      const bool leftFirst = leftEntry <= rightEntry;
+      stack[stackSize++] = leftFirst ? std::pair{ node.first + 1, rightEntry } : std::pair{ node.first, leftEntry };
+      stack[stackSize++] = leftFirst ? std::pair{ node.first, leftEntry } : std::pair{ node.first + 1, rightEntry };
+    }
+    else if (leftEntry >= 0.0f)
+    {
+      stack[stackSize++] = { node.first, leftEntry };
+    }
+    else if (rightEntry >= 0.0f)
+    {
+      stack[stackSize++] = { node.first + 1, rightEntry };
+    }
+  }
+}
+
+
+
+#endif //AABBTREE_H
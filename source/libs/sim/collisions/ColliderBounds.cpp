@@ -0,0 +1,141 @@
+#include "ColliderBounds.h"
+#include "../CollisionSystem.h"
+#include <cmath>
+#include <utility>
+
+size_t ColliderBounds::refresh(const std::vector<CollisionEdge>& edges)
+{
+  const size_t count = edges.size();
+
+  m_minX.resize(count);
+  m_maxX.resize(count);
+  m_minY.resize(count);
+  m_maxY.resize(count);
+  m_minZ.resize(count);
+  m_maxZ.resize(count);
+
+  m_staleSlots.clear();
+  m_staleUpdateIDs.clear();
+  for (auto& center : m_centers)
+  {
+    center.clear();
+  }
+  for (auto& axis : m_axes)
+  {
+    axis.clear();
+  }
+
+  // Gather: the one per-collider (virtual) step left is asking a stale collider for its shape.
+  for (size_t slot = 0; slot < count; ++slot)
+  {
+    auto& collider = *edges[slot].collider;
+
+    uint8_t transformUpdateID = 0;
+    if (!collider.isBoundingBoxStale(transformUpdateID))
+    {
+      setSlot(slot, collider.getCachedBoundingBox());
+      continue;
+    }
+
+    const auto shape = collider.getBoundsShape();
+
+    m_staleSlots.push_back(static_cast<uint32_t>(slot));
+    m_staleUpdateIDs.push_back(transformUpdateID);
+    for (int component = 0; component < 3; ++component)
+    {
+      m_centers[component].push_back(shape.center[component]);
+    }
+    for (int column = 0; column < 3; ++column)
+    {
+      for (int component = 0; component < 3; ++component)
+      {
+        m_axes[column * 3 + component].push_back(shape.axes[column][component]);
+      }
+    }
+  }
+
+  const size_t staleCount = m_staleSlots.size();
+  if (staleCount == 0)
+  {
+    return 0;
+  }
+
+  for (auto& extent : m_extents)
+  {
+    extent.resize(staleCount);
+  }
+
+  // Half-extent along each world axis = the sum of that component's magnitude over the three shape axes,
+  // summed in the same order as makeBoundingBox so both paths agree to the bit.
+  for (int component = 0; component < 3; ++component)
+  {
+    const float* axis0 = m_axes[component].data();
+    const float* axis1 = m_axes[3 + component].data();
+    const float* axis2 = m_axes[6 + component].data();
+    float* extent = m_extents[component].data();
+
+#pragma omp simd
+    for (size_t i = 0; i < staleCount; ++i)
+    {
+      extent[i] = std::abs(axis0[i]) + std::abs(axis1[i]) + std::abs(axis2[i]);
+    }
+  }
+
+  // Scatter into the slots and back into the colliders' caches.
+  for (size_t i = 0; i < staleCount; ++i)
+  {
+    BoundingBox boundingBox;
+    boundingBox.lastUpdateID = m_staleUpdateIDs[i];
+    boundingBox.minX = m_centers[0][i] - m_extents[0][i];
+    boundingBox.maxX = m_centers[0][i] + m_extents[0][i];
+    boundingBox.minY = m_centers[1][i] - m_extents[1][i];
+    boundingBox.maxY = m_centers[1][i] + m_extents[1][i];
+    boundingBox.minZ = m_centers[2][i] - m_extents[2][i];
+    boundingBox.maxZ = m_centers[2][i] + m_extents[2][i];
+
+    const uint32_t slot = m_staleSlots[i];
+    setSlot(slot, boundingBox);
+    edges[slot].collider->setBoundingBox(boundingBox);
+  }
+
+  return staleCount;
+}
+
+void ColliderBounds::permute(const std::vector<uint32_t>& order)
+{
+  const auto reorder = [&](std::vector<float>& values) {
+    std::vector<float> reordered(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      reordered[i] = values[order[i]];
+    }
+    values = std::move(reordered);
+  };
+
+  reorder(m_minX);
+  reorder(m_maxX);
+  reorder(m_minY);
+  reorder(m_maxY);
+  reorder(m_minZ);
+  reorder(m_maxZ);
+}
+
+void ColliderBounds::clear()
+{
+  m_minX.clear();
+  m_maxX.clear();
+  m_minY.clear();
+  m_maxY.clear();
+  m_minZ.clear();
+  m_maxZ.clear();
+}
+
+void ColliderBounds::setSlot(const size_t slot, const BoundingBox& boundingBox)
+{
+  m_minX[slot] = boundingBox.minX;
+  m_maxX[slot] = boundingBox.maxX;
+  m_minY[slot] = boundingBox.minY;
+  m_maxY[slot] = boundingBox.maxY;
+  m_minZ[slot] = boundingBox.minZ;
+  m_maxZ[slot] = boundingBox.maxZ;
+}
@@ -70,7 +70,7 @@ glm::vec3 Polytope::findCollisionPoint() const
   {
     auto direction = glm::normalize(closestPoint);
 
-    pointOfCollision = transform->getPosition() + direction * dynamic_cast<SphereCollider*>(m_collider)->getRadius();
+    pointOfCollision = m_collider->getPosition() + direction * dynamic_cast<SphereCollider*>(m_collider)->getRadius();
 
     return pointOfCollision;
   }
@@ -79,7 +79,7 @@ glm::vec3 Polytope::findCollisionPoint() const
   {
     auto direction = glm::normalize(closestPoint);
 
-    pointOfCollision = otherTransform->getPosition() + direction * std::dynamic_pointer_cast<SphereCollider>(m_otherCollider)->getRadius();
+    pointOfCollision = m_otherCollider->getPosition() + direction * std::dynamic_pointer_cast<SphereCollider>(m_otherCollider)->getRadius();
 
     return pointOfCollision;
   }
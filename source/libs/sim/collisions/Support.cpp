@@ -1,7 +1,37 @@
 #include "Support.h"
+#include "../queries/QueryShape.h"
 #include <objects/components/collisions/Collider.h>
+#include <objects/components/collisions/ConvexHull.h>
+#include <glm/glm.hpp>
 
 glm::vec3 getSupport(Collider* collider, const std::shared_ptr<Collider>& other, const glm::vec3& direction)
 {
   return collider->findFurthestPoint(direction) - other->findFurthestPoint(-direction);
 }
+
+glm::vec3 findFurthestPoint(const QueryShape& shape, const glm::vec3& direction)
+{
+  if (shape.type == ColliderType::sphereCollider)
+  {
+    return shape.center + direction * shape.radius;
+  }
+
+  if (shape.type == ColliderType::convexHullCollider)
+  {
+    // As the collider's own support, climbing from the first vertex (a snapshot has no previous answer).
+    const glm::vec3 local = transpose(glm::mat3(shape.matrix)) * direction;
+    const glm::vec3& vertex = shape.hull->getVertices()[shape.hull->findFurthestVertex(local)];
+
+    return glm::vec3(shape.matrix * glm::vec4(vertex, 1.0f));
+  }
+
+  // The box is the unit cube [-1,1]^3 under matrix, so its furthest corner along direction is the one whose
+  // local coordinates share the signs of direction pulled back through the linear part (dot(M v, d) ==
+  // dot(v, M^T d)) - the vertex BoxCollider::findFurthestPoint would pick, without scanning all eight.
+  const glm::vec3 local = transpose(glm::mat3(shape.matrix)) * direction;
+  const glm::vec3 corner(local.x >= 0.0f ? 1.0f : -1.0f,
+                         local.y >= 0.0f ? 1.0f : -1.0f,
+                         local.z >= 0.0f ? 1.0f : -1.0f);
+
+  return glm::vec3(shape.matrix * glm::vec4(corner, 1.0f));
+}
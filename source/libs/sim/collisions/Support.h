@@ -5,11 +5,16 @@
 #include <memory>
 
 class Collider;
+struct QueryShape;
 
 // Minkowski-difference support point. Lives in ECS3DSim because it is part of the GJK/EPA algorithm,
 // and it only reads the colliders' (data) geometry.
 glm::vec3 getSupport(Collider* collider, const std::shared_ptr<Collider>& other, const glm::vec3& direction);
 
+// The same furthest-point function the live colliders give GJK, over a query snapshot instead, so the scene
+// queries' shape casts can run GJK without touching a collider. direction must be normalized.
+glm::vec3 findFurthestPoint(const QueryShape& shape, const glm::vec3& direction);
+
 
 
 #endif //SUPPORT_H
@@ -0,0 +1,63 @@
+#include "QueryShape.h"
+#include <objects/Object.h>
+#include <objects/components/collisions/BoxCollider.h>
+#include <objects/components/collisions/CompoundCollider.h>
+#include <objects/components/collisions/ConvexHullCollider.h>
+#include <objects/components/collisions/SphereCollider.h>
+
+size_t appendQueryShapes(const Object& object, const std::shared_ptr<Collider>& collider, std::vector<QueryShape>& shapes)
+{
+  QueryShape shape;
+  shape.object = object.getUUID();
+  shape.layer = collider->getLayer();
+  shape.type = collider->getColliderType();
+
+  switch (shape.type)
+  {
+    case ColliderType::sphereCollider:
+    {
+      const auto sphere = std::dynamic_pointer_cast<SphereCollider>(collider);
+      shape.center = sphere->getPosition();
+      shape.radius = sphere->getRadius();
+      shapes.push_back(shape);
+      return 1;
+    }
+    case ColliderType::boxCollider:
+    {
+      // The box's cached matrices - the same ones its collision mesh is built from, so ray/overlap match
+      // what actually collides.
+      const auto box = std::dynamic_pointer_cast<BoxCollider>(collider);
+      shape.matrix = box->getWorldMatrix();
+      shape.inverseMatrix = box->getInverseWorldMatrix();
+      shapes.push_back(shape);
+      return 1;
+    }
+    case ColliderType::convexHullCollider:
+    {
+      const auto hull = std::dynamic_pointer_cast<ConvexHullCollider>(collider);
+      shape.matrix = hull->getWorldMatrix();
+      shape.inverseMatrix = hull->getInverseWorldMatrix();
+      shape.hull = hull->getHull();
+      shapes.push_back(shape);
+      return 1;
+    }
+    case ColliderType::compoundCollider:
+    {
+      // Each shape under the compound's object and layer (the shapes' own layers are unused).
+      size_t appended = 0;
+      for (const auto& part : std::static_pointer_cast<CompoundCollider>(collider)->getShapes())
+      {
+        const size_t first = shapes.size();
+        appended += appendQueryShapes(object, part, shapes);
+
+        for (size_t i = first; i < shapes.size(); ++i)
+        {
+          shapes[i].layer = shape.layer;
+        }
+      }
+      return appended;
+    }
+  }
+
+  return 0;
+}
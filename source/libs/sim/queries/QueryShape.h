@@ -0,0 +1,44 @@
+#ifndef QUERYSHAPE_H
+#define QUERYSHAPE_H
+
+#include <objects/components/collisions/Collider.h>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <uuid.h>
+
+class ConvexHull;
+class Object;
+
+// One collider as the scene queries see it: a plain copy of its world-space shape. CollisionSystem takes
+// these at the end of each pass (alongside the AABB tree it builds over them), so a query reads flat data
+// instead of walking the object's components, and concurrent queries never touch a live collider.
+struct QueryShape {
+  uuids::uuid object;
+  uint32_t layer = 0;
+  ColliderType type = ColliderType::boxCollider;
+
+  // sphereCollider
+  glm::vec3 center{ 0.0f };
+  float radius = 0.0f;
+
+  // boxCollider: maps the unit box [-1,1]^3 into world space, and back.
+  // convexHullCollider: maps the hull's own frame into world space, and back.
+  glm::mat4 matrix{ 1.0f };
+  glm::mat4 inverseMatrix{ 1.0f };
+
+  // convexHullCollider: the collider's hull, shared rather than copied (it's immutable; a rebuild swaps the
+  // collider's pointer and leaves this one alone).
+  std::shared_ptr<const ConvexHull> hull;
+};
+
+// Snapshot collider (owned by object) onto shapes: one shape for a box, sphere or hull, one per shape for
+// a compound. Returns how many were appended.
+size_t appendQueryShapes(const Object& object, const std::shared_ptr<Collider>& collider, std::vector<QueryShape>& shapes);
+
+
+
+#endif //QUERYSHAPE_H
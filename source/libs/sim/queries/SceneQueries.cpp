@@ -1,41 +1,31 @@
 #include "SceneQueries.h"
+#include "QueryShape.h"
+#include "../CollisionSystem.h"
+#include "../collisions/AabbTree.h"
+#include "../collisions/Simplex.h"
+#include "../collisions/Support.h"
+#include <JobSystem.h>
 #include <objects/Object.h>
 #include <objects/ObjectManager.h>
 #include <objects/components/Component.h>
-#include <objects/components/Transform.h>
 #include <objects/components/collisions/Collider.h>
-#include <objects/components/collisions/BoxCollider.h>
-#include <objects/components/collisions/SphereCollider.h>
+#include <objects/components/collisions/ConvexHull.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace {
   constexpr float kEpsilon = 1e-8f;
 
-  bool layerInMask(const std::shared_ptr<Collider>& collider, const uint32_t layerMask)
+  bool layerInMask(const uint32_t layer, const uint32_t layerMask)
   {
-    return (layerMask & (1u << collider->getLayer())) != 0u;
-  }
-
-  // The box's world matrix, built the same way BoxCollider::generateTransformedMesh does (note: the box's
-  // own getScale() adds transform+local, but the collision mesh multiplies - so mirror the mesh here so
-  // ray/overlap match what actually collides). Maps the unit box [-1,1]^3 into world space.
-  glm::mat4 boxWorldMatrix(const std::shared_ptr<Transform>& transform, const std::shared_ptr<BoxCollider>& box)
-  {
-    const glm::vec3 position = transform->getPosition() + box->getLocalPosition();
-    const glm::vec3 rotation = transform->getRotation() + box->getLocalRotation();
-    const glm::vec3 scale = transform->getScale() * box->getLocalScale();
-
-    return translate(glm::mat4(1.0f), position)
-      * rotate(glm::mat4(1.0f), glm::radians(rotation.z), {0, 0, 1})
-      * rotate(glm::mat4(1.0f), glm::radians(rotation.y), {0, 1, 0})
-      * rotate(glm::mat4(1.0f), glm::radians(rotation.x), {1, 0, 0})
-      * glm::scale(glm::mat4(1.0f), scale);
+    return (layerMask & (1u << layer)) != 0u;
   }
 
   // Ray vs sphere. dir must be normalized. Writes the nearest forward hit distance + surface normal.
@@ -76,13 +66,12 @@ namespace {
     return true;
   }
 
-  // Ray vs oriented box, via the box's world matrix: bring the ray into the box's local [-1,1]^3 space
-  // (the transform is linear, so the ray parameter t is preserved and is world distance since dir is
-  // normalized) and slab-test. dir must be normalized.
-  bool rayBox(const glm::vec3& origin, const glm::vec3& dir, const glm::mat4& boxMatrix,
+  // Ray vs oriented box, via the inverse of the box's world matrix: bring the ray into the box's local
+  // [-1,1]^3 space (the transform is linear, so the ray parameter t is preserved and is world distance
+  // since dir is normalized) and slab-test. dir must be normalized.
+  bool rayBox(const glm::vec3& origin, const glm::vec3& dir, const glm::mat4& inverseMatrix,
               const float maxDistance, float& tHit, glm::vec3& normal)
   {
-    const glm::mat4 inverseMatrix = inverse(boxMatrix);
     const glm::vec3 localOrigin = glm::vec3(inverseMatrix * glm::vec4(origin, 1.0f));
     const glm::vec3 localDir = glm::vec3(inverseMatrix * glm::vec4(dir, 0.0f));
 
@@ -150,13 +139,127 @@ namespace {
     return true;
   }
 
-  // Whether a sphere overlaps an oriented box, via the closest point on the box to the sphere centre.
-  bool sphereOverlapsBox(const glm::vec3& center, const float radius, const glm::mat4& boxMatrix)
+  // Ray vs convex hull: the slab test generalised to the hull's face planes, in the hull's own frame (again
+  // a linear map, so t is unchanged). dir must be normalized.
+  bool rayHull(const glm::vec3& origin, const glm::vec3& dir, const QueryShape& shape, const float maxDistance,
+               float& tHit, glm::vec3& normal)
+  {
+    const glm::vec3 localOrigin = glm::vec3(shape.inverseMatrix * glm::vec4(origin, 1.0f));
+    const glm::vec3 localDir = glm::vec3(shape.inverseMatrix * glm::vec4(dir, 0.0f));
+
+    float tMin = -std::numeric_limits<float>::max();
+    float tMax = std::numeric_limits<float>::max();
+    const glm::vec4* hitPlane = nullptr;
+
+    for (const auto& plane : shape.hull->getPlanes())
+    {
+      const glm::vec3 planeNormal(plane);
+      const float height = dot(planeNormal, localOrigin) - plane.w;
+      const float approach = dot(planeNormal, localDir);
+
+      if (std::abs(approach) < kEpsilon)
+      {
+        // Ray parallel to this face: miss if it starts outside it.
+        if (height > 0.0f)
+        {
+          return false;
+        }
+        continue;
+      }
+
+      // Heading against the normal enters through this face, along it leaves.
+      const float t = -height / approach;
+      if (approach < 0.0f)
+      {
+        if (t > tMin)
+        {
+          tMin = t;
+          hitPlane = &plane;
+        }
+      }
+      else
+      {
+        tMax = std::min(tMax, t);
+      }
+
+      if (tMin > tMax)
+      {
+        return false;
+      }
+    }
+
+    // As rayBox: behind the origin is a miss, and a ray started inside reports contact at the origin.
+    if (!hitPlane || tMax < 0.0f)
+    {
+      return false;
+    }
+
+    const float t = std::max(tMin, 0.0f);
+    if (t > maxDistance)
+    {
+      return false;
+    }
+
+    tHit = t;
+    normal = normalize(glm::mat3(transpose(shape.inverseMatrix)) * glm::vec3(*hitPlane));
+    return true;
+  }
+
+  bool sphereOverlapsHull(const glm::vec3& center, const float radius, const QueryShape& shape)
+  {
+    Simplex simplex;
+    return CollisionSystem::intersects([&](const glm::vec3& direction) {
+      return center + direction * radius - findFurthestPoint(shape, -direction);
+    }, simplex);
+  }
+
+  // Roughly the point of a hull nearest point: point dropped onto the face plane it lies furthest outside,
+  // which is exact over that face and close near its edges and corners. Point itself when it's inside.
+  glm::vec3 closestPointOnHull(const QueryShape& shape, const glm::vec3& point)
+  {
+    const glm::vec3 local = glm::vec3(shape.inverseMatrix * glm::vec4(point, 1.0f));
+
+    const glm::vec4* nearestPlane = nullptr;
+    float height = 0.0f;
+    for (const auto& plane : shape.hull->getPlanes())
+    {
+      if (const float planeHeight = dot(glm::vec3(plane), local) - plane.w; planeHeight > height)
+      {
+        height = planeHeight;
+        nearestPlane = &plane;
+      }
+    }
+
+    if (!nearestPlane)
+    {
+      return point;
+    }
+
+    return glm::vec3(shape.matrix * glm::vec4(local - glm::vec3(*nearestPlane) * height, 1.0f));
+  }
+
+  // The hull's local bounding box as a centre and half-extent per (scaled, rotated) axis of its matrix.
+  void hullAxes(const QueryShape& shape, glm::vec3& center, glm::mat3& axes)
+  {
+    const glm::vec3 min = shape.hull->getMin();
+    const glm::vec3 max = shape.hull->getMax();
+    const glm::vec3 halfExtent = 0.5f * (max - min);
+
+    center = glm::vec3(shape.matrix * glm::vec4(0.5f * (min + max), 1.0f));
+    axes = glm::mat3(shape.matrix);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      axes[axis] *= halfExtent[axis];
+    }
+  }
+
+  // The point of an oriented box nearest point (point itself when it's inside the box).
+  glm::vec3 closestPointOnBox(const glm::mat4& boxMatrix, const glm::vec3& point)
   {
     // Box centre + the (scaled) axes are the columns of the world matrix; length of each column is the
     // half-extent along that axis, the normalized column is the axis direction.
     const glm::vec3 boxCenter = glm::vec3(boxMatrix[3]);
-    const glm::vec3 delta = center - boxCenter;
+    const glm::vec3 delta = point - boxCenter;
 
     glm::vec3 closest = boxCenter;
     for (int axis = 0; axis < 3; ++axis)
@@ -173,8 +276,244 @@ namespace {
       closest += direction * distance;
     }
 
+    return closest;
+  }
+
+  // Whether a sphere overlaps an oriented box, via the closest point on the box to the sphere centre.
+  bool sphereOverlapsBox(const glm::vec3& center, const float radius, const glm::mat4& boxMatrix)
+  {
+    const glm::vec3 closest = closestPointOnBox(boxMatrix, center);
     return dot(center - closest, center - closest) <= radius * radius;
   }
+
+  bool rayShape(const glm::vec3& origin, const glm::vec3& dir, const QueryShape& shape, const float maxDistance,
+                float& tHit, glm::vec3& normal)
+  {
+    if (shape.type == ColliderType::sphereCollider)
+    {
+      return raySphere(origin, dir, shape.center, shape.radius, maxDistance, tHit, normal);
+    }
+
+    if (shape.type == ColliderType::convexHullCollider)
+    {
+      return rayHull(origin, dir, shape, maxDistance, tHit, normal);
+    }
+
+    return rayBox(origin, dir, shape.inverseMatrix, maxDistance, tHit, normal);
+  }
+
+  bool sphereOverlapsShape(const glm::vec3& center, const float radius, const QueryShape& shape)
+  {
+    if (shape.type == ColliderType::sphereCollider)
+    {
+      const glm::vec3 delta = shape.center - center;
+      const float combined = shape.radius + radius;
+      return dot(delta, delta) <= combined * combined;
+    }
+
+    if (shape.type == ColliderType::convexHullCollider)
+    {
+      return sphereOverlapsHull(center, radius, shape);
+    }
+
+    return sphereOverlapsBox(center, radius, shape.matrix);
+  }
+
+  glm::vec3 shapeCenter(const QueryShape& shape)
+  {
+    return shape.type == ColliderType::sphereCollider ? shape.center : glm::vec3(shape.matrix[3]);
+  }
+
+  // World bounds of a shape (for a box, the extents of its transformed unit cube; for a hull, of its box).
+  Aabb shapeBounds(const QueryShape& shape)
+  {
+    if (shape.type == ColliderType::sphereCollider)
+    {
+      return { shape.center - glm::vec3(shape.radius), shape.center + glm::vec3(shape.radius) };
+    }
+
+    if (shape.type == ColliderType::convexHullCollider)
+    {
+      glm::vec3 center;
+      glm::mat3 axes;
+      hullAxes(shape, center, axes);
+
+      const glm::vec3 extent = abs(axes[0]) + abs(axes[1]) + abs(axes[2]);
+      return { center - extent, center + extent };
+    }
+
+    const glm::vec3 center = glm::vec3(shape.matrix[3]);
+    const glm::vec3 extent = abs(glm::vec3(shape.matrix[0])) + abs(glm::vec3(shape.matrix[1])) +
+                             abs(glm::vec3(shape.matrix[2]));
+    return { center - extent, center + extent };
+  }
+
+  float smallestHalfExtent(const QueryShape& shape)
+  {
+    if (shape.type == ColliderType::sphereCollider)
+    {
+      return shape.radius;
+    }
+
+    if (shape.type == ColliderType::convexHullCollider)
+    {
+      glm::vec3 center;
+      glm::mat3 axes;
+      hullAxes(shape, center, axes);
+
+      return std::min({ length(axes[0]), length(axes[1]), length(axes[2]) });
+    }
+
+    return std::min({ length(glm::vec3(shape.matrix[0])), length(glm::vec3(shape.matrix[1])),
+                      length(glm::vec3(shape.matrix[2])) });
+  }
+
+  // The surface point of shape nearest point (for a box or hull, point itself when it's inside).
+  glm::vec3 closestPointOnShape(const QueryShape& shape, const glm::vec3& point)
+  {
+    if (shape.type == ColliderType::sphereCollider)
+    {
+      const glm::vec3 offset = point - shape.center;
+      const float offsetLength = length(offset);
+      return offsetLength > kEpsilon ? shape.center + offset * (shape.radius / offsetLength) : point;
+    }
+
+    if (shape.type == ColliderType::convexHullCollider)
+    {
+      return closestPointOnHull(shape, point);
+    }
+
+    return closestPointOnBox(shape.matrix, point);
+  }
+
+  // The stretch [enter, exit] of [0, maxDistance] over which moving, translated along dir (normalized), overlaps
+  // still. False if it never does.
+  bool sweptBoundsOverlap(const Aabb& moving, const glm::vec3& dir, const float maxDistance, const Aabb& still,
+                          float& enter, float& exit)
+  {
+    enter = 0.0f;
+    exit = maxDistance;
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      // Overlapping on this axis while the travelled offset dir * t lies in [low, high].
+      const float low = still.min[axis] - moving.max[axis];
+      const float high = still.max[axis] - moving.min[axis];
+
+      if (std::abs(dir[axis]) < kEpsilon)
+      {
+        if (low > 0.0f || high < 0.0f)
+        {
+          return false;
+        }
+        continue;
+      }
+
+      float t1 = low / dir[axis];
+      float t2 = high / dir[axis];
+      if (t1 > t2)
+      {
+        std::swap(t1, t2);
+      }
+
+      enter = std::max(enter, t1);
+      exit = std::min(exit, t2);
+
+      if (enter > exit)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  // How far cast (bounds castBounds) can travel along dir (normalized) before touching shape, or -1 if it
+  // stays clear for maxDistance. 0 if they already overlap.
+  float castAgainst(const QueryShape& cast, const Aabb& castBounds, const glm::vec3& dir, const float maxDistance,
+                    const QueryShape& shape)
+  {
+    // Only the stretch where the bounds overlap can hold the contact; march just that.
+    float enter = 0.0f;
+    float exit = 0.0f;
+    if (!sweptBoundsOverlap(castBounds, dir, maxDistance, shapeBounds(shape), enter, exit))
+    {
+      return -1.0f;
+    }
+
+    const auto touchesAt = [&](const float t) {
+      const glm::vec3 offset = dir * t;
+      Simplex simplex;
+      return CollisionSystem::intersects([&](const glm::vec3& direction) {
+        return findFurthestPoint(cast, direction) + offset - findFurthestPoint(shape, -direction);
+      }, simplex);
+    };
+
+    // The shapes can't overlap before their bounds do, so touching at enter means touching from there.
+    if (touchesAt(enter))
+    {
+      return enter;
+    }
+
+    // Steps no longer than the thinner shape's smallest half-extent, so neither can pass through the other
+    // between samples (capped, like timeOfImpact, so a long cast against a thin collider stays bounded).
+    constexpr int maxSteps = 64;
+    const float step = std::max(std::min(smallestHalfExtent(cast), smallestHalfExtent(shape)), kEpsilon);
+    const int steps = std::clamp(static_cast<int>(std::ceil((exit - enter) / step)), 1, maxSteps);
+
+    float clear = enter;
+    float hit = -1.0f;
+    for (int i = 1; i <= steps; ++i)
+    {
+      const float t = enter + (exit - enter) * static_cast<float>(i) / static_cast<float>(steps);
+      if (touchesAt(t))
+      {
+        hit = t;
+        break;
+      }
+
+      clear = t;
+    }
+
+    if (hit < 0.0f)
+    {
+      return -1.0f;
+    }
+
+    // Bisect the bracketing interval, keeping the clear side: the distance the caster can actually move.
+    constexpr int refinements = 8;
+    for (int i = 0; i < refinements; ++i)
+    {
+      const float mid = 0.5f * (clear + hit);
+      if (touchesAt(mid))
+      {
+        hit = mid;
+      }
+      else
+      {
+        clear = mid;
+      }
+    }
+
+    return clear;
+  }
+}
+
+const CollisionSystem* SceneQueries::s_collisionSystem = nullptr;
+
+void SceneQueries::setCollisionSystem(const CollisionSystem* collisionSystem)
+{
+  s_collisionSystem = collisionSystem;
+}
+
+const CollisionSystem* SceneQueries::broadphaseFor(const ObjectManager& objectManager)
+{
+  if (s_collisionSystem && s_collisionSystem->getQueryObjectManager() == &objectManager)
+  {
+    return s_collisionSystem;
+  }
+
+  return nullptr;
 }
 
 bool SceneQueries::raycast(ObjectManager& objectManager,
@@ -190,49 +529,50 @@ bool SceneQueries::raycast(ObjectManager& objectManager,
   const glm::vec3 dir = direction / dirLength;
 
   bool hitAnything = false;
-  float nearest = maxDistance;
 
-  for (const auto& object : objectManager.getAllObjects())
-  {
-    if (object->getUUID() == ignoreObject)
+  const auto testShape = [&](const QueryShape& shape, float& nearest) {
+    if (shape.object == ignoreObject || !layerInMask(shape.layer, layerMask))
     {
-      continue; // skip the caster's own object (nil ignoreObject matches nothing)
-    }
-
-    const auto collider = object->getComponent<Collider>(ComponentType::collider);
-    if (!collider || !layerInMask(collider, layerMask))
-    {
-      continue;
+      return; // skip the caster's own object (nil ignoreObject matches nothing)
     }
 
     float t = 0.0f;
     glm::vec3 normal(0.0f);
-    bool hit = false;
 
-    if (collider->getColliderType() == ColliderType::sphereCollider)
-    {
-      const auto sphere = std::dynamic_pointer_cast<SphereCollider>(collider);
-      hit = raySphere(origin, dir, sphere->getPosition(), sphere->getRadius(), nearest, t, normal);
-    }
-    else
-    {
-      const auto box = std::dynamic_pointer_cast<BoxCollider>(collider);
-      const auto transform = object->getComponent<Transform>(ComponentType::transform);
-      if (box && transform)
-      {
-        hit = rayBox(origin, dir, boxWorldMatrix(transform, box), nearest, t, normal);
-      }
-    }
-
-    if (hit && t <= nearest)
+    if (rayShape(origin, dir, shape, nearest, t, normal) && t <= nearest)
     {
       hitAnything = true;
       nearest = t;
-      hitObject = object->getUUID();
+      hitObject = shape.object;
       hitPoint = origin + dir * t;
       hitNormal = normal;
       hitDistance = t;
     }
+  };
+
+  if (const auto collisionSystem = broadphaseFor(objectManager))
+  {
+    // The trees hand each candidate the current nearest distance, and stop descending past it.
+    collisionSystem->raycastBroadphase(origin, dir, maxDistance, layerMask, testShape);
+
+    return hitAnything;
+  }
+
+  float nearest = maxDistance;
+
+  std::vector<QueryShape> shapes;
+  for (const auto& object : objectManager.getAllObjects())
+  {
+    if (const auto collider = object->getComponent<Collider>(ComponentType::collider))
+    {
+      shapes.clear();
+      appendQueryShapes(*object, collider, shapes);
+
+      for (const auto& shape : shapes)
+      {
+        testShape(shape, nearest);
+      }
+    }
   }
 
   return hitAnything;
@@ -243,41 +583,193 @@ void SceneQueries::overlapSphere(ObjectManager& objectManager,
                                  const uuids::uuid& ignoreObject,
                                  std::vector<uuids::uuid>& results)
 {
+  const auto firstResult = static_cast<std::ptrdiff_t>(results.size());
+
+  const auto testShape = [&](const QueryShape& shape) {
+    if (shape.object == ignoreObject || !layerInMask(shape.layer, layerMask))
+    {
+      return; // skip the caster's own object (nil ignoreObject matches nothing)
+    }
+
+    // A compound's shapes share its object; report the object once however many of them overlap.
+    if (sphereOverlapsShape(center, radius, shape) &&
+        std::find(results.begin() + firstResult, results.end(), shape.object) == results.end())
+    {
+      results.push_back(shape.object);
+    }
+  };
+
+  if (const auto collisionSystem = broadphaseFor(objectManager))
+  {
+    collisionSystem->queryBroadphase({ center - glm::vec3(radius), center + glm::vec3(radius) }, layerMask, testShape);
+
+    return;
+  }
+
+  std::vector<QueryShape> shapes;
   for (const auto& object : objectManager.getAllObjects())
   {
-    if (object->getUUID() == ignoreObject)
+    if (const auto collider = object->getComponent<Collider>(ComponentType::collider))
     {
-      continue; // skip the caster's own object (nil ignoreObject matches nothing)
+      shapes.clear();
+      appendQueryShapes(*object, collider, shapes);
+
+      for (const auto& shape : shapes)
+      {
+        testShape(shape);
+      }
     }
+  }
+}
+
+bool SceneQueries::sphereCast(ObjectManager& objectManager,
+                              const glm::vec3& origin, const float radius, const glm::vec3& direction,
+                              const float maxDistance, const uint32_t layerMask, const uuids::uuid& ignoreObject,
+                              uuids::uuid& hitObject, glm::vec3& hitPoint, glm::vec3& hitNormal, float& hitDistance)
+{
+  QueryShape cast;
+  cast.type = ColliderType::sphereCollider;
+  cast.center = origin;
+  cast.radius = radius;
+
+  return shapeCast(objectManager, cast, direction, maxDistance, layerMask, ignoreObject,
+                   hitObject, hitPoint, hitNormal, hitDistance);
+}
+
+bool SceneQueries::boxCast(ObjectManager& objectManager,
+                           const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& rotation,
+                           const glm::vec3& direction, const float maxDistance,
+                           const uint32_t layerMask, const uuids::uuid& ignoreObject,
+                           uuids::uuid& hitObject, glm::vec3& hitPoint, glm::vec3& hitNormal, float& hitDistance)
+{
+  // Built exactly like BoxCollider's world matrix, so a cast box lines up with a collider given the same
+  // position/rotation/scale.
+  QueryShape cast;
+  cast.type = ColliderType::boxCollider;
+  cast.matrix = translate(glm::mat4(1.0f), center)
+    * rotate(glm::mat4(1.0f), glm::radians(rotation.z), {0, 0, 1})
+    * rotate(glm::mat4(1.0f), glm::radians(rotation.y), {0, 1, 0})
+    * rotate(glm::mat4(1.0f), glm::radians(rotation.x), {1, 0, 0})
+    * scale(glm::mat4(1.0f), halfExtents);
+  cast.inverseMatrix = inverse(cast.matrix);
+
+  return shapeCast(objectManager, cast, direction, maxDistance, layerMask, ignoreObject,
+                   hitObject, hitPoint, hitNormal, hitDistance);
+}
+
+bool SceneQueries::shapeCast(ObjectManager& objectManager, const QueryShape& cast,
+                             const glm::vec3& direction, const float maxDistance,
+                             const uint32_t layerMask, const uuids::uuid& ignoreObject,
+                             uuids::uuid& hitObject, glm::vec3& hitPoint, glm::vec3& hitNormal, float& hitDistance)
+{
+  const float dirLength = length(direction);
+  if (dirLength < kEpsilon || maxDistance < 0.0f)
+  {
+    return false;
+  }
+  const glm::vec3 dir = direction / dirLength;
 
-    const auto collider = object->getComponent<Collider>(ComponentType::collider);
-    if (!collider || !layerInMask(collider, layerMask))
+  const Aabb castBounds = shapeBounds(cast);
+
+  bool hitAnything = false;
+  float nearest = maxDistance;
+
+  const auto testShape = [&](const QueryShape& shape) {
+    if (shape.object == ignoreObject || !layerInMask(shape.layer, layerMask))
     {
-      continue;
+      return; // skip the caster's own object (nil ignoreObject matches nothing)
     }
 
-    bool overlaps = false;
+    // Searching only up to the nearest hit so far also skips candidates whose bounds lie beyond it.
+    const float t = castAgainst(cast, castBounds, dir, nearest, shape);
+    if (t < 0.0f)
+    {
+      return;
+    }
+
+    hitAnything = true;
+    nearest = t;
+    hitObject = shape.object;
+    hitDistance = t;
 
-    if (collider->getColliderType() == ColliderType::sphereCollider)
+    const glm::vec3 castCenter = shapeCenter(cast) + dir * t;
+    if (t == 0.0f)
     {
-      const auto sphere = std::dynamic_pointer_cast<SphereCollider>(collider);
-      const glm::vec3 delta = sphere->getPosition() - center;
-      const float combined = sphere->getRadius() + radius;
-      overlaps = dot(delta, delta) <= combined * combined;
+      // Already overlapping: like a ray started inside a collider, report contact at the start.
+      hitPoint = castCenter;
+      hitNormal = -dir;
+      return;
     }
-    else
+
+    hitPoint = closestPointOnShape(shape, castCenter);
+    const glm::vec3 away = castCenter - hitPoint;
+    const float awayLength = length(away);
+    hitNormal = awayLength > kEpsilon ? away / awayLength : -dir;
+  };
+
+  if (const auto collisionSystem = broadphaseFor(objectManager))
+  {
+    Aabb swept = castBounds;
+    swept.expand({ castBounds.min + dir * maxDistance, castBounds.max + dir * maxDistance });
+
+    collisionSystem->queryBroadphase(swept, layerMask, testShape);
+
+    return hitAnything;
+  }
+
+  std::vector<QueryShape> shapes;
+  for (const auto& object : objectManager.getAllObjects())
+  {
+    if (const auto collider = object->getComponent<Collider>(ComponentType::collider))
     {
-      const auto box = std::dynamic_pointer_cast<BoxCollider>(collider);
-      const auto transform = object->getComponent<Transform>(ComponentType::transform);
-      if (box && transform)
+      shapes.clear();
+      appendQueryShapes(*object, collider, shapes);
+
+      for (const auto& shape : shapes)
       {
-        overlaps = sphereOverlapsBox(center, radius, boxWorldMatrix(transform, box));
+        testShape(shape);
       }
     }
+  }
 
-    if (overlaps)
+  return hitAnything;
+}
+
+void SceneQueries::raycastBatch(ObjectManager& objectManager, const std::vector<RaycastQuery>& queries,
+                                std::vector<RaycastResult>& results)
+{
+  results.assign(queries.size(), RaycastResult{});
+
+  // A handful of rays isn't worth a hand-off to the workers; the fallback scan stays in one chunk.
+  constexpr size_t queriesPerChunk = 16;
+  const size_t grain = broadphaseFor(objectManager) ? queriesPerChunk : queries.size();
+
+  JobSystem::parallelFor("queries.raycastBatch", queries.size(), grain, [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i)
     {
-      results.push_back(object->getUUID());
+      const auto& query = queries[i];
+      auto& result = results[i];
+
+      result.hit = raycast(objectManager, query.origin, query.direction, query.maxDistance, query.layerMask,
+                           query.ignoreObject, result.object, result.point, result.normal, result.distance);
     }
-  }
+  });
+}
+
+void SceneQueries::overlapSphereBatch(ObjectManager& objectManager, const std::vector<OverlapSphereQuery>& queries,
+                                      std::vector<std::vector<uuids::uuid>>& results)
+{
+  results.assign(queries.size(), {});
+
+  constexpr size_t queriesPerChunk = 16;
+  const size_t grain = broadphaseFor(objectManager) ? queriesPerChunk : queries.size();
+
+  JobSystem::parallelFor("queries.overlapSphereBatch", queries.size(), grain, [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      const auto& query = queries[i];
+
+      overlapSphere(objectManager, query.center, query.radius, query.layerMask, query.ignoreObject, results[i]);
+    }
+  });
 }
@@ -1,20 +1,33 @@
 #ifndef SCENEQUERIES_H
 #define SCENEQUERIES_H
 
+#include <queries/SceneQueryTypes.h>
 #include <glm/vec3.hpp>
 #include <cstdint>
 #include <vector>
 #include <uuid.h>
 
 class ObjectManager;
+class CollisionSystem;
+struct QueryShape;
 
-// Analytic scene queries (raycast, sphere overlap) over the collider geometry. Lives in sim because it
+// Scene queries (raycast, sphere overlap, sphere/box casts) over the collider geometry. Lives in sim because it
 // is query *behavior* over the data (the data/systems split), but scripting can't link sim - so the
 // server app injects these two statics into BindingContext as function pointers at startup. The
 // signatures below therefore use only types both sim and scripting can see (data + glm + uuid) and must
 // stay matched to BindingContext::RaycastFn / OverlapSphereFn.
+//
+// Queries go through the CollisionSystem's broadphase (AABB trees over snapshots of every collider, see
+// CollisionSystem::queryBroadphase) once the server has pointed them at it, so a query costs roughly the
+// colliders its ray/sphere actually passes near rather than the whole scene. They therefore see the world
+// as of the last collision pass: an object spawned or teleported by a script earlier in the same tick shows
+// up from the next pass. Until a pass has run for the queried scene (or with no collision system set) they
+// fall back to a linear scan of the live colliders.
 class SceneQueries {
 public:
+  // The collision system whose broadphase the queries use (null = always scan). Set once at startup.
+  static void setCollisionSystem(const CollisionSystem* collisionSystem);
+
   // Cast a ray (origin + normalized direction is computed internally) against every collider whose layer
   // is in layerMask. Returns true on the nearest hit within maxDistance, writing the outputs only then.
   // ignoreObject (nil = none) is skipped, so a caster can exclude its own collider. A ray that starts
@@ -30,6 +43,51 @@ public:
                             const glm::vec3& center, float radius, uint32_t layerMask,
                             const uuids::uuid& ignoreObject,
                             std::vector<uuids::uuid>& results);
+
+  // Sweep a sphere (centred at origin) along direction and report the first collider it would touch, whose
+  // layer is in layerMask, within maxDistance. hitDistance is how far the sphere can travel before touching
+  // (so moving a body by it leaves it just clear), hitPoint the touched collider's surface point nearest the
+  // sphere's centre there and hitNormal the direction from that point back to the centre. A sphere that
+  // already overlaps a collider reports it at distance 0 with the normal against the cast. One sweep
+  // replaces the fan of rays a character controller would otherwise cast for its capsule/feet.
+  static bool sphereCast(ObjectManager& objectManager,
+                         const glm::vec3& origin, float radius, const glm::vec3& direction, float maxDistance,
+                         uint32_t layerMask, const uuids::uuid& ignoreObject,
+                         uuids::uuid& hitObject, glm::vec3& hitPoint, glm::vec3& hitNormal, float& hitDistance);
+
+  // sphereCast for an oriented box: halfExtents along its local axes, rotation in Euler degrees applied
+  // like a Transform's (z, then y, then x). The hit point is the touched surface point nearest the box's
+  // centre, which is the contact for a face-on hit and an approximation for an edge or corner one.
+  static bool boxCast(ObjectManager& objectManager,
+                      const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& rotation,
+                      const glm::vec3& direction, float maxDistance,
+                      uint32_t layerMask, const uuids::uuid& ignoreObject,
+                      uuids::uuid& hitObject, glm::vec3& hitPoint, glm::vec3& hitNormal, float& hitDistance);
+
+  // Batched forms for callers issuing many queries at once (e.g. AI line-of-sight across every agent):
+  // results[i] answers queries[i], exactly as the single query would. Against the broadphase snapshot the
+  // queries are read-only, so the batch runs across the JobSystem's workers; the fallback scan touches
+  // live colliders and stays serial.
+  static void raycastBatch(ObjectManager& objectManager, const std::vector<RaycastQuery>& queries,
+                           std::vector<RaycastResult>& results);
+
+  static void overlapSphereBatch(ObjectManager& objectManager, const std::vector<OverlapSphereQuery>& queries,
+                                 std::vector<std::vector<uuids::uuid>>& results);
+
+private:
+  static const CollisionSystem* s_collisionSystem;
+
+  // Shared sweep behind sphereCast/boxCast: cast is the moving shape at its start. Candidates come from
+  // the broadphase under the swept bounds; each is narrowed to the stretch of the path where the bounds
+  // overlap, stepped along it with GJK (the collider pass's test, over snapshot support functions) no
+  // further than the thinner shape's smallest half-extent, and the first touching step bisected down.
+  static bool shapeCast(ObjectManager& objectManager, const QueryShape& cast,
+                        const glm::vec3& direction, float maxDistance,
+                        uint32_t layerMask, const uuids::uuid& ignoreObject,
+                        uuids::uuid& hitObject, glm::vec3& hitPoint, glm::vec3& hitNormal, float& hitDistance);
+
+  // The collision system if its query tree was built for objectManager, else null (use the fallback scan).
+  [[nodiscard]] static const CollisionSystem* broadphaseFor(const ObjectManager& objectManager);
 };
 
 